@@ -27,296 +27,150 @@ namespace forge
 
 	// -------------------------------- EXPLICIT SPECIALIZATIONS --------------
 
-	// Shift allToFen bits up a number of rows
-	template<> void BitBoard::shift<directions::Up>(uint8_t numberOfRows) {
-		(*this) = (*this) >> (numberOfRows << 3);
-	}
-
-	// Shift allToFen bits down a number of rows
-	template<> void BitBoard::shift<directions::Down>(uint8_t numberOfRows) {
-		(*this) = (*this) << (numberOfRows << 3);
-	}
-
-	// Shift allToFen bits left a number of cols.
-	// Bits might overflow into downward rows 
-	template<> void BitBoard::shift<directions::Left>(uint8_t numberOfCols) {
-		(*this) = (*this) >> numberOfCols;
-	}
-
-	// Shift allToFen bits left a number of cols.
-	// Bits might overflow into upward rows 
-	template<> void BitBoard::shift<directions::Right>(uint8_t numberOfCols) {
-		(*this) = (*this) << numberOfCols;
-	}
-
 	// ---------------------- MASK --------------------------------------------
+	// All masks are looked up from the precomputed tables. See BitBoardTables.h
+
 	template<>
 	BitBoard BitBoard::mask<directions::Knight0>(BoardSquare center)
 	{
-		BitBoard bb;
-
-		if (center.isKnight0InBounds()) bb[center.knight0()] = 1;
-
-		return bb;
+		return tables::knightSteps[0][center.val()];
 	}
 
 	template<>
 	BitBoard BitBoard::mask<directions::Knight1>(BoardSquare center)
 	{
-		BitBoard bb;
-
-		if (center.isKnight1InBounds()) bb[center.knight1()] = 1;
-
-		return bb;
+		return tables::knightSteps[1][center.val()];
 	}
 
 	template<>
 	BitBoard BitBoard::mask<directions::Knight2>(BoardSquare center)
 	{
-		BitBoard bb;
-
-		if (center.isKnight2InBounds()) bb[center.knight2()] = 1;
-
-		return bb;
+		return tables::knightSteps[2][center.val()];
 	}
 
 	template<>
 	BitBoard BitBoard::mask<directions::Knight3>(BoardSquare center)
 	{
-		BitBoard bb;
-
-		if (center.isKnight3InBounds()) bb[center.knight3()] = 1;
-
-		return bb;
+		return tables::knightSteps[3][center.val()];
 	}
 
 	template<>
 	BitBoard BitBoard::mask<directions::Knight4>(BoardSquare center)
 	{
-		BitBoard bb;
-
-		if (center.isKnight4InBounds()) bb[center.knight4()] = 1;
-
-		return bb;
+		return tables::knightSteps[4][center.val()];
 	}
 
 	template<>
 	BitBoard BitBoard::mask<directions::Knight5>(BoardSquare center)
 	{
-		BitBoard bb;
-
-		if (center.isKnight5InBounds()) bb[center.knight5()] = 1;
-
-		return bb;
+		return tables::knightSteps[5][center.val()];
 	}
 
 	template<>
 	BitBoard BitBoard::mask<directions::Knight6>(BoardSquare center)
 	{
-		BitBoard bb;
-
-		if (center.isKnight6InBounds()) bb[center.knight6()] = 1;
-
-		return bb;
+		return tables::knightSteps[6][center.val()];
 	}
 
 	template<>
 	BitBoard BitBoard::mask<directions::Knight7>(BoardSquare center)
 	{
-		BitBoard bb;
-
-		if (center.isKnight7InBounds()) bb[center.knight7()] = 1;
-
-		return bb;
+		return tables::knightSteps[7][center.val()];
 	}
 
 	template<>
 	BitBoard BitBoard::mask<directions::Horizontal>(BoardSquare center)
 	{
-		BitBoard top = 0b00000000'00000000'00000000'00000000'00000000'00000000'00000000'11111111;
-
-		top.shift<directions::Down>(center.row());
-
-		return top;
+		return tables::rays[tables::LEFT][center.val()] | tables::rays[tables::RIGHT][center.val()] | (1ull << center.val());
 	}
 
 	template<>
 	BitBoard BitBoard::mask<directions::Vertical>(BoardSquare center)
 	{
-		BitBoard left = 0b00000001'00000001'00000001'00000001'00000001'00000001'00000001'00000001;
-
-		left.shift<directions::Right>(center.col());
-
-		return left;
+		return tables::rays[tables::UP][center.val()] | tables::rays[tables::DOWN][center.val()] | (1ull << center.val());
 	}
 
 	template<>
 	BitBoard BitBoard::mask<directions::Lateral>(BoardSquare center)
 	{
-		return
-			BitBoard::mask<directions::Horizontal>(center) |
-			BitBoard::mask<directions::Vertical>(center);
+		return tables::laterals[center.val()];
 	}
 
 	template<>
 	BitBoard BitBoard::mask<directions::MainDiagonal>(BoardSquare center)
 	{
 		// Diagonal direction: / 
-		const BitBoard POS_DIAGONAL = 0b00000001'00000010'00000100'00001000'00010000'00100000'01000000'10000000;
-
-		BitBoard bb = POS_DIAGONAL;
-
-		int mainShift = 7 - (center.row() + center.col());
-
-		if (mainShift > 0) {
-			bb.shift<directions::Up>(mainShift);
-		}
-		else {
-			bb.shift<directions::Down>(-mainShift);
-		}
-
-		return bb;
+		return tables::rays[tables::UP_RIGHT][center.val()] | tables::rays[tables::DOWN_LEFT][center.val()] | (1ull << center.val());
 	}
 
 	template<>
 	BitBoard BitBoard::mask<directions::OffDiagonal>(BoardSquare center)
 	{
-		const BitBoard NEG_DIAGONAL = 0b10000000'01000000'00100000'00010000'00001000'00000100'00000010'00000001;
-
-		BitBoard bb = NEG_DIAGONAL;
-
-		int inverseShift = (int)center.row() - (int)center.col();
-
-		if (inverseShift > 0) {
-			bb.shift<directions::Down>(inverseShift);
-		}
-		else {
-			bb.shift<directions::Up>(-inverseShift);
-		}
-
-		return bb;
+		// Diagonal direction: \ ..
+		return tables::rays[tables::UP_LEFT][center.val()] | tables::rays[tables::DOWN_RIGHT][center.val()] | (1ull << center.val());
 	}
 
 	template<>
 	BitBoard BitBoard::mask<directions::Diagonal>(BoardSquare center)
 	{
-		return
-			BitBoard::mask<directions::MainDiagonal>(center) |
-			BitBoard::mask<directions::OffDiagonal>(center);
+		return tables::diagonals[center.val()];
 	}
 
 	// --- Ray Masks ---
+	// Ray masks do not include 'center'.
 
 	template<>
 	BitBoard BitBoard::mask<directions::Up>(BoardSquare center)
 	{
-		BitBoard left = 0b00000001'00000001'00000001'00000001'00000001'00000001'00000001'00000001;
-
-		left.shift<directions::Up>(8 - center.row());
-		left.shift<directions::Right>(center.col());
-
-		return left;
+		return tables::rays[tables::UP][center.val()];
 	}
 
 	template<>
 	BitBoard BitBoard::mask<directions::Down>(BoardSquare center)
 	{
-		BitBoard left = 0b00000001'00000001'00000001'00000001'00000001'00000001'00000001'00000001;
-
-		left.shift<directions::Down>(center.row());
-		left.shift<directions::Right>(center.col());
-
-		return left;
+		return tables::rays[tables::DOWN][center.val()];
 	}
 
 	template<>
 	BitBoard BitBoard::mask<directions::Left>(BoardSquare center)
 	{
-		BitBoard top = 0b00000000'00000000'00000000'00000000'00000000'00000000'00000000'11111111;
-
-		top.shift<directions::Left>(8 - center.col());
-		top.shift<directions::Down>(center.row());
-
-		return top;
+		return tables::rays[tables::LEFT][center.val()];
 	}
 
 	template<>
 	BitBoard BitBoard::mask<directions::Right>(BoardSquare center)
 	{
-		BitBoard bottom = 0b11111111'00000000'00000000'00000000'00000000'00000000'00000000'00000000;
-
-		bottom.shift<directions::Right>(center.col());
-		bottom.shift<directions::Up>(7 - center.row());
-
-		return bottom;
+		return tables::rays[tables::RIGHT][center.val()];
 	}
 
 	template<>
 	BitBoard BitBoard::mask<directions::UL>(BoardSquare center)
 	{
-		// Diagonal direction: \ ..
-		BitBoard negDiag = 0b10000000'01000000'00100000'00010000'00001000'00000100'00000010'00000001;
-
-		negDiag.shift<directions::Down>(7 - center.col());
-		negDiag.shift<directions::Up>(7 - center.row());
-
-		return negDiag;
+		return tables::rays[tables::UP_LEFT][center.val()];
 	}
 
 	template<>
 	BitBoard BitBoard::mask<directions::UR>(BoardSquare center)
 	{
-		// Diagonal direction: /  
-		BitBoard posDiag = 0b00000001'00000010'00000100'00001000'00010000'00100000'01000000'10000000;
-
-		posDiag.shift<directions::Down>(center.col());
-		posDiag.shift<directions::Up>(7 - center.row());
-
-		return posDiag;
+		return tables::rays[tables::UP_RIGHT][center.val()];
 	}
 
 	template<>
 	BitBoard BitBoard::mask<directions::DL>(BoardSquare center)
 	{
-		// Diagonal direction: / 
-		BitBoard posDiag = 0b00000001'00000010'00000100'00001000'00010000'00100000'01000000'10000000;
-
-		posDiag.shift<directions::Up>(7 - center.col());
-		posDiag.shift<directions::Down>(center.row());
-
-		return posDiag;
+		return tables::rays[tables::DOWN_LEFT][center.val()];
 	}
 
 	template<>
 	BitBoard BitBoard::mask<directions::DR>(BoardSquare center)
 	{
-		// Diagonal direction: \ ..
-		BitBoard negDiag = 0b10000000'01000000'00100000'00010000'00001000'00000100'00000010'00000001;
-
-		negDiag.shift<directions::Up>(center.col());
-		negDiag.shift<directions::Down>(center.row());
-
-		return negDiag;
+		return tables::rays[tables::DOWN_RIGHT][center.val()];
 	}
 
 	template<>
 	BitBoard BitBoard::mask<directions::LShape>(BoardSquare center)
 	{
-		BitBoard bb;
-
-		// TODO: OPTIMIZE: This can be optimized to bitwise operations only
-		// no ifs. Also consider making it inline
-
-		if (center.isKnight0InBounds()) bb[center.knight0()] = 1;
-		if (center.isKnight1InBounds()) bb[center.knight1()] = 1;
-		if (center.isKnight2InBounds()) bb[center.knight2()] = 1;
-		if (center.isKnight3InBounds()) bb[center.knight3()] = 1;
-		if (center.isKnight4InBounds()) bb[center.knight4()] = 1;
-		if (center.isKnight5InBounds()) bb[center.knight5()] = 1;
-		if (center.isKnight6InBounds()) bb[center.knight6()] = 1;
-		if (center.isKnight7InBounds()) bb[center.knight7()] = 1;
-
-		return bb;
+		return tables::knights[center.val()];
 	}
 
 	std::ostream & operator<<(std::ostream & os, const BitBoard & bb)
@@ -324,7 +178,7 @@ namespace forge
 		for (size_t bit = 0; bit < 64; bit++) {
 			if (bit % 8 == 0 && bit != 0)	os << '\'';
 
-			os << static_cast<std::bitset<64>>(bb)[bit];
+			os << bb[bit];
 		}
 
 		return os;
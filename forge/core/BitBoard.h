@@ -1,17 +1,30 @@
 #pragma once
 
+#include "forge/core/BitBoardTables.h"
 #include "forge/core/Direction.h"
 
 // TODO: REMOVE
 //#include "Guten/core/Matrix.h"
 
 #include <iostream>
-#include <bitset>
+#include <stdint.h>
 
 #ifdef _DEBUG
 #include <cassert>
 #endif // _DEBUG
 
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif // _MSC_VER
+
+// GCC and Clang evaluate their bit builtins at compile time. MSVC's intrinsics can't be, 
+// so BitBoard methods that use them are only constexpr on GCC and Clang.
+#ifdef _MSC_VER
+#define FORGE_BIT_INTRINSIC inline
+#else
+#define FORGE_BIT_INTRINSIC constexpr
+#endif // _MSC_VER
+
 namespace forge
 {
 	// --- Forward Declarations ---
@@ -28,49 +41,186 @@ namespace forge
 		48 49 50 51 52 53 54 55
 		56 57 58 59 60 61 62 63
 	*/
-	class BitBoard : public std::bitset<64>
+	// 64 bits stored in a single uint64_t. Bit 'i' is the square with index 'i' (see above).
+	// Construction, bitwise operators, shifts and bit counting are all constexpr
+	// so masks can be built at compile time.
+	// Bit scans and counts compile to single instructions (popcnt, tzcnt/bsf, lzcnt/bsr) where available.
+	class BitBoard
 	{
 	public:
-		BitBoard() = default;
-		BitBoard(unsigned long long l) : std::bitset<64>(l) {};
-		BitBoard(const BitBoard& bb) = default;
-		BitBoard(const std::bitset<64>& bset) : std::bitset<64>(bset) {};
-		~BitBoard() noexcept = default;
-		BitBoard& operator=(const BitBoard&) = default;
-
-		std::bitset<64>::reference operator[](size_t i) {
-			return static_cast<bitset<64> &>(*this)[i];
-		}
-		bool operator[](size_t i) const {
-			return this->std::bitset<64>::operator[](i);
-		}
+		// Proxy to 1 bit so that bits can be assigned with operator[]
+		// ex: bb[square] = 1;
+		class Reference
+		{
+		public:
+			constexpr Reference(uint64_t & bits, uint64_t mask) : m_bits(bits), m_mask(mask) {}
+
+			constexpr operator bool() const { return (m_bits & m_mask) != 0; }
+
+			constexpr Reference & operator=(bool value) {
+				if (value)	m_bits |= m_mask;
+				else		m_bits &= ~m_mask;
+				return *this;
+			}
+			constexpr Reference & operator=(const Reference & ref) { return (*this) = bool(ref); }
+
+		private:
+			uint64_t & m_bits;
+			uint64_t m_mask;
+		};
+
+		constexpr BitBoard() = default;
+		constexpr BitBoard(unsigned long long bits) : m_bits(bits) {}
+
+		// Only square 'index' is set
+		static constexpr BitBoard square(uint8_t index) { return BitBoard{ 1ull << (index & 63) }; }
+		static BitBoard square(BoardSquare square) { return BitBoard::square(square.val()); }
+
+		constexpr uint64_t bits() const { return m_bits; }
+
+		// --- Bit Access ---
+		// Indices are taken modulo 64. The shift instructions do the same so this is free.
+
+		constexpr bool operator[](size_t i) const { return (m_bits >> (i & 63)) & 1; }
+		constexpr bool operator[](int i) const { return (m_bits >> (i & 63)) & 1; }
+		bool operator[](BoardSquare square) const { return (*this)[square.val()]; }
+
+		constexpr Reference operator[](size_t i) { return Reference{ m_bits, 1ull << (i & 63) }; }
+		constexpr Reference operator[](int i) { return Reference{ m_bits, 1ull << (i & 63) }; }
+		Reference operator[](BoardSquare square) { return (*this)[square.val()]; }
+
+		constexpr bool test(size_t i) const { return (*this)[i]; }
+
+		constexpr BitBoard & set() { m_bits = ~0ull; return *this; }
+		constexpr BitBoard & set(size_t i) { m_bits |= (1ull << (i & 63)); return *this; }
+		constexpr BitBoard & reset() { m_bits = 0; return *this; }
+		constexpr BitBoard & reset(size_t i) { m_bits &= ~(1ull << (i & 63)); return *this; }
+		constexpr BitBoard & flip() { m_bits = ~m_bits; return *this; }
+		constexpr BitBoard & flip(size_t i) { m_bits ^= (1ull << (i & 63)); return *this; }
+
+		// --- Counting ---
+
+		static constexpr size_t size() { return 64; }
+
+		// Number of 1 bits
+		FORGE_BIT_INTRINSIC size_t count() const { return popcount(m_bits); }
+
+		constexpr bool any() const { return m_bits != 0; }
+		constexpr bool none() const { return m_bits == 0; }
+		constexpr bool all() const { return m_bits == ~0ull; }
+
+		// True iff more than 1 bit is set. Cheaper than count() > 1.
+		constexpr bool several() const { return (m_bits & (m_bits - 1)) != 0; }
+
+		// --- Bit Scans ---
+		// WARNING: Results are undefined when BitBoard is empty (all zeros).
+
+		// Returns index of the least significant 1 bit.
+		// Range: [0, 63]
+		FORGE_BIT_INTRINSIC uint8_t lsb() const { return lsb(m_bits); }
 
-		std::bitset<64>::reference operator[](int i) {
-			return static_cast<bitset<64> &>(*this)[i];
+		// Returns index of the most significant 1 bit.
+		// Range: [0, 63]
+		FORGE_BIT_INTRINSIC uint8_t msb() const { return msb(m_bits); }
+
+		// Clears the least significant 1 bit and returns its index.
+		// ex:
+		//	while (bb.any()) { uint8_t square = bb.popLsb(); ... }
+		FORGE_BIT_INTRINSIC uint8_t popLsb() {
+			uint8_t index = lsb();
+			m_bits &= m_bits - 1;
+			return index;
 		}
-		bool operator[](int i) const {
-			return this->std::bitset<64>::operator[](i);
+
+		// Same as above but for raw bits.
+		static FORGE_BIT_INTRINSIC size_t popcount(uint64_t bits)
+		{
+#ifdef _MSC_VER
+			return static_cast<size_t>(__popcnt64(bits));
+#else
+			return static_cast<size_t>(__builtin_popcountll(bits));
+#endif // _MSC_VER
 		}
 
-		std::bitset<64>::reference operator[](const BoardSquare& square) {
-			return (*this)[square.val()];
+		static FORGE_BIT_INTRINSIC uint8_t lsb(uint64_t bits)
+		{
+#ifdef _MSC_VER
+			unsigned long index;
+			_BitScanForward64(&index, bits);
+			return static_cast<uint8_t>(index);
+#else
+			return static_cast<uint8_t>(__builtin_ctzll(bits));
+#endif // _MSC_VER
 		}
-		bool operator[](const BoardSquare& square) const {
-			return (*this)[square.val()];
+
+		static FORGE_BIT_INTRINSIC uint8_t msb(uint64_t bits)
+		{
+#ifdef _MSC_VER
+			unsigned long index;
+			_BitScanReverse64(&index, bits);
+			return static_cast<uint8_t>(index);
+#else
+			return static_cast<uint8_t>(63 ^ __builtin_clzll(bits));
+#endif // _MSC_VER
 		}
 
+		// --- Operators ---
+		// Shifts must be less than 64.
+
+		constexpr BitBoard & operator&=(BitBoard rhs) { m_bits &= rhs.m_bits; return *this; }
+		constexpr BitBoard & operator|=(BitBoard rhs) { m_bits |= rhs.m_bits; return *this; }
+		constexpr BitBoard & operator^=(BitBoard rhs) { m_bits ^= rhs.m_bits; return *this; }
+		constexpr BitBoard & operator<<=(size_t shift) { m_bits <<= shift; return *this; }
+		constexpr BitBoard & operator>>=(size_t shift) { m_bits >>= shift; return *this; }
+
+		friend constexpr BitBoard operator&(BitBoard lhs, BitBoard rhs) { return BitBoard{ lhs.m_bits & rhs.m_bits }; }
+		friend constexpr BitBoard operator|(BitBoard lhs, BitBoard rhs) { return BitBoard{ lhs.m_bits | rhs.m_bits }; }
+		friend constexpr BitBoard operator^(BitBoard lhs, BitBoard rhs) { return BitBoard{ lhs.m_bits ^ rhs.m_bits }; }
+		friend constexpr BitBoard operator<<(BitBoard lhs, size_t shift) { return BitBoard{ lhs.m_bits << shift }; }
+		friend constexpr BitBoard operator>>(BitBoard lhs, size_t shift) { return BitBoard{ lhs.m_bits >> shift }; }
+		constexpr BitBoard operator~() const { return BitBoard{ ~m_bits }; }
+
+		friend constexpr bool operator==(BitBoard lhs, BitBoard rhs) { return lhs.m_bits == rhs.m_bits; }
+		friend constexpr bool operator!=(BitBoard lhs, BitBoard rhs) { return lhs.m_bits != rhs.m_bits; }
+
+		// Iterates over the squares of the 1 bits, from least to most significant.
+		// Only set bits are visited, so a sparse BitBoard costs a few steps instead of 64.
+		// ex: 
+		//	for (BoardSquare square : bb) { ... }
+		class Iterator
+		{
+		public:
+			constexpr Iterator(uint64_t bits) : m_bits(bits) {}
+
+			BoardSquare operator*() const { return BoardSquare{ lsb(m_bits) }; }
+
+			// Clears the least significant 1 bit
+			constexpr Iterator & operator++() { m_bits &= m_bits - 1; return *this; }
+
+			constexpr bool operator==(const Iterator & it) const { return m_bits == it.m_bits; }
+			constexpr bool operator!=(const Iterator & it) const { return m_bits != it.m_bits; }
+
+		private:
+			uint64_t m_bits;
+		};
+
+		constexpr Iterator begin() const { return Iterator{ m_bits }; }
+		constexpr Iterator end() const { return Iterator{ 0 }; }
+
 		// Rotates the BitBoard 180 degrees. 
 		// Same as rotating pieces without rotating the chess board.
 		// Does not flip bits (0 to 1, 1 to 0)
 		BitBoard rotated() const;
 
+		// Moves every bit a number of steps in some direction.
+		// Bits that fall off the edge of the board are lost. They never wrap onto the next row.
+		constexpr BitBoard & shift(directions::direction_t dir, uint8_t numberOfCells = 1) {
+			for (uint8_t i = 0; i < numberOfCells; i++) m_bits = directions::shift(m_bits, dir);
+			return *this;
+		}
+
 		template<typename DIRECTION_T>
-		void shift(uint8_t numberOfCells);/* {
-			static_assert(true,
-				"This method is the unspeciallized template. "
-				"Don't call this method. "
-				"Instead call a fully specialized overload instead.");
-		}*/
+		constexpr BitBoard & shift(uint8_t numberOfCells) { return shift(DIRECTION_T::index, numberOfCells); }
 
 		// Draws a line of 1s between begin and end.
 		// Inclusive on begin
@@ -83,6 +233,9 @@ namespace forge
 		template<typename RAY_DIRECTION_T>
 		static BitBoard mask(BoardSquare begin, BoardSquare end);
 
+		// Squares in some direction(s) from center on an empty board.
+		// Lines (ex: Horizontal, Lateral, Diagonal) include center.
+		// Rays (ex: Up, UL) and Knight directions don't.
 		template<typename DIRECTION_T>
 		static BitBoard mask(BoardSquare center);
 
@@ -91,6 +244,7 @@ namespace forge
 		void print(std::ostream& os = std::cout) const;
 
 	private:
+		uint64_t m_bits = 0;
 	}; // class BitBoard
 
 	// -------------------------------- METHOD DEFINITIONS --------------------
@@ -113,17 +267,8 @@ namespace forge
 		}
 #endif
 
-		BitBoard bb;
-
-		// TODO: Optimize: This can really be optimized. 
-		// We do not need a loop at allToFen. Only bitwise operations.
-		while (begin.operator!=(end)) {
-			bb[begin] = 1;	// Set bit to 1
-
-			begin = RAY_DIRECTION_T{}(begin);
-		}
-
-		return bb;
+		// Squares between begin and end, then begin itself
+		return tables::between[begin.val()][end.val()] | (1ull << begin.val());
 	}
 
 	// Unspecialized definition
@@ -146,7 +291,7 @@ namespace std
 	public:
 		std::size_t operator()(const forge::BitBoard& b) const noexcept
 		{
-			return std::hash<std::bitset<64>>{}(b);
+			return std::hash<uint64_t>{}(b.bits());
 		}
 	};
 }
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <array>
+#include <stdint.h>
+
+namespace forge
+{
+	// Precomputed BitBoards for every square and every pair of squares.
+	// Generated at compile time so that finding a ray, a line or the squares between
+	// two pieces is a single table lookup instead of a loop that walks the board.
+	// Squares are indexed the same way as the bits of a BitBoard. See BitBoard.h
+	//	ex: tables::between[a.val()][b.val()]
+	namespace tables
+	{
+		using table_t = std::array<uint64_t, 64>;
+		using pair_table_t = std::array<table_t, 64>;
+
+		// Index of each ray direction into 'rays'
+		// Opposite directions are next to each other: opposite = dir ^ 1
+		const uint8_t UP = 0;
+		const uint8_t DOWN = 1;
+		const uint8_t LEFT = 2;
+		const uint8_t RIGHT = 3;
+		const uint8_t UP_LEFT = 4;
+		const uint8_t DOWN_RIGHT = 5;
+		const uint8_t UP_RIGHT = 6;
+		const uint8_t DOWN_LEFT = 7;
+
+		// Left (a) and right (h) files
+		const uint64_t FILE_A = 0x01'01'01'01'01'01'01'01ull;
+		const uint64_t FILE_H = 0x80'80'80'80'80'80'80'80ull;
+
+		// Row and col steps of each ray direction. Row 0 is the top of the board.
+		// The only definition of these steps. directions::direction_t is built from them too.
+		constexpr int RAY_DELTAS[8][2] = {
+			{ -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 },
+			{ -1, -1 }, { 1, 1 }, { -1, 1 }, { 1, -1 },
+		};
+
+		// Row and col steps of each Knight direction (Knight0 to Knight7). See Direction.h
+		constexpr int KNIGHT_DELTAS[8][2] = {
+			{ -1, 2 }, { -2, 1 }, { -2, -1 }, { -1, -2 },
+			{ 1, -2 }, { 2, -1 }, { 2, 1 }, { 1, 2 },
+		};
+
+		namespace detail
+		{
+			constexpr bool inBounds(int row, int col) { return row >= 0 && row < 8 && col >= 0 && col < 8; }
+
+			constexpr uint64_t bit(int row, int col) { return uint64_t{ 1 } << (row * 8 + col); }
+
+			// Squares reached by sliding from each square in each ray direction.
+			// Excludes the starting square.
+			constexpr std::array<table_t, 8> genRays()
+			{
+				std::array<table_t, 8> rays{};
+
+				for (int dir = 0; dir < 8; dir++) {
+					for (int square = 0; square < 64; square++) {
+						int row = square / 8 + RAY_DELTAS[dir][0];
+						int col = square % 8 + RAY_DELTAS[dir][1];
+
+						while (inBounds(row, col)) {
+							rays[dir][square] |= bit(row, col);
+
+							row += RAY_DELTAS[dir][0];
+							col += RAY_DELTAS[dir][1];
+						}
+					}
+				}
+
+				return rays;
+			}
+
+			// Square 1 step away from each square in each of 'deltas'. Empty when off the board.
+			constexpr std::array<table_t, 8> genSteps(const int(&deltas)[8][2])
+			{
+				std::array<table_t, 8> steps{};
+
+				for (int dir = 0; dir < 8; dir++) {
+					for (int square = 0; square < 64; square++) {
+						int row = square / 8 + deltas[dir][0];
+						int col = square % 8 + deltas[dir][1];
+
+						if (inBounds(row, col)) steps[dir][square] = bit(row, col);
+					}
+				}
+
+				return steps;
+			}
+
+			// Union of all 8 directions of 'steps' for each square.
+			constexpr table_t genUnion(const std::array<table_t, 8> & steps)
+			{
+				table_t all{};
+
+				for (int dir = 0; dir < 8; dir++) {
+					for (int square = 0; square < 64; square++) {
+						all[square] |= steps[dir][square];
+					}
+				}
+
+				return all;
+			}
+
+			// Full lines through each square made of 2 opposite rays and the square itself.
+			constexpr table_t genLines(const std::array<table_t, 8> & rays, int dir1, int dir2, int dir3, int dir4)
+			{
+				table_t lines{};
+
+				for (int square = 0; square < 64; square++) {
+					lines[square] =
+						rays[dir1][square] | rays[dir2][square] | rays[dir3][square] | rays[dir4][square] |
+						(uint64_t{ 1 } << square);
+				}
+
+				return lines;
+			}
+
+			constexpr pair_table_t genBetween()
+			{
+				pair_table_t between{};
+
+				for (int a = 0; a < 64; a++) {
+					for (int dir = 0; dir < 8; dir++) {
+						uint64_t passed = 0;	// Squares walked over so far
+						int row = a / 8 + RAY_DELTAS[dir][0];
+						int col = a % 8 + RAY_DELTAS[dir][1];
+
+						while (inBounds(row, col)) {
+							between[a][row * 8 + col] = passed;
+							passed |= bit(row, col);
+
+							row += RAY_DELTAS[dir][0];
+							col += RAY_DELTAS[dir][1];
+						}
+					}
+				}
+
+				return between;
+			}
+
+			constexpr pair_table_t genLine(const std::array<table_t, 8> & rays)
+			{
+				pair_table_t line{};
+
+				for (int a = 0; a < 64; a++) {
+					for (int dir = 0; dir < 8; dir++) {
+						int opposite = dir ^ 1;
+						uint64_t full = rays[dir][a] | rays[opposite][a] | (uint64_t{ 1 } << a);
+
+						for (int b = 0; b < 64; b++) {
+							if (rays[dir][a] & (uint64_t{ 1 } << b)) line[a][b] = full;
+						}
+					}
+				}
+
+				return line;
+			}
+		} // namespace detail
+
+		// Squares a slider on a square sees on an empty board in one direction.
+		// Excludes the square itself.
+		//	ex: rays[UP][square]
+		inline constexpr std::array<table_t, 8> rays = detail::genRays();
+
+		// Square 1 Knight move away in each Knight direction (Knight0 to Knight7).
+		inline constexpr std::array<table_t, 8> knightSteps = detail::genSteps(KNIGHT_DELTAS);
+
+		// Squares a Knight on a square attacks.
+		inline constexpr table_t knights = detail::genUnion(knightSteps);
+
+		// Squares a King on a square attacks.
+		inline constexpr table_t kings = detail::genUnion(detail::genSteps(RAY_DELTAS));
+
+		// Row and column through a square. Includes the square itself.
+		inline constexpr table_t laterals = detail::genLines(rays, UP, DOWN, LEFT, RIGHT);
+
+		// Both diagonals through a square. Includes the square itself.
+		inline constexpr table_t diagonals = detail::genLines(rays, UP_LEFT, UP_RIGHT, DOWN_LEFT, DOWN_RIGHT);
+
+		// Squares strictly between 2 squares on the same row, column or diagonal.
+		// Empty when the squares are not lined up or are next to each other.
+		inline constexpr pair_table_t between = detail::genBetween();
+
+		// The whole row, column or diagonal (edge to edge) through 2 lined up squares.
+		// Empty when the squares are not lined up.
+		inline constexpr pair_table_t line = detail::genLine(rays);
+	} // namespace tables
+} // namespace forge
\ No newline at end of file
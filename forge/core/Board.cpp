@@ -36,12 +36,11 @@ namespace forge
 		guten::boards::CheckerBoard disp;
 		disp.draw();
 
-		for (int row = 0; row < this->rows(); row++) {
-			for (int col = 0; col < this->cols(); col++) {
-				const pieces::Piece & p = (*this).at(row, col);
+		// Empty squares are already drawn. Only place the pieces.
+		for (BoardSquare bs : this->occupied()) {
+			const pieces::Piece & p = (*this).at(bs);
 
-				disp.placePiece(p.getCh(), row, col, p.isWhite());
-			}
+			disp.placePiece(p.getCh(), bs.row(), bs.col(), p.isWhite());
 		}
 
 		return disp;
@@ -72,39 +71,35 @@ namespace forge
 		return miniBoard;
 	}
 
-	pieces::Piece Board::at(int row, int col) const
+	void Board::updateMailbox()
 	{
-		return this->at(BoardSquare(
-			static_cast<uint16_t>(row),
-			static_cast<uint16_t>(col)));
-	}
+		for (uint8_t i = 0; i < 64; i++) {
+			const BoardSquare square{ i };
+			pieces::Piece piece;
 
-	pieces::Piece Board::at(BoardSquare square) const
-	{
-		pieces::Piece piece;
-
-		if (isEmpty(square)) {
-			piece = pieces::empty;
-		}
-		else {
-			// Just assume piece is white for now.
-			// Well make sure at the bottom.
-
-			if (isPawn(square)) { piece = pieces::whitePawn; }
-			else if (isBishop(square)) { piece = pieces::whiteBishop; }
-			else if (isRook(square)) { piece = pieces::whiteRook; }
-			else if (isQueen(square)) { piece = pieces::whiteQueen; }
-			else if (isKnight(square)) { piece = pieces::whiteKnight; }
-			else { piece = pieces::whiteKing; }
-
-			// Was the piece infact white or black?
-			if (isBlack(square)) {
-				// It should be black
-				piece.flipColor();	// Change color to black;
+			if (isEmpty(square)) {
+				piece = pieces::empty;
+			}
+			else {
+				// Just assume piece is white for now.
+				// Well make sure at the bottom.
+
+				if (isPawn(square)) { piece = pieces::whitePawn; }
+				else if (isBishop(square)) { piece = pieces::whiteBishop; }
+				else if (isRook(square)) { piece = pieces::whiteRook; }
+				else if (isQueen(square)) { piece = pieces::whiteQueen; }
+				else if (isKnight(square)) { piece = pieces::whiteKnight; }
+				else { piece = pieces::whiteKing; }
+
+				// Was the piece infact white or black?
+				if (isBlack(square)) {
+					// It should be black
+					piece.flipColor();	// Change color to black;
+				}
 			}
-		}
 
-		return piece;
+			m_mailbox[i] = piece;
+		}
 	}
 
 	Board Board::rotated() const
@@ -120,6 +115,7 @@ namespace forge
 		b.m_pawns = m_pawns.rotated();
 		b.m_whiteKing = m_whiteKing.rotated();
 		b.m_blackKing = m_blackKing.rotated();
+		b.updateMailbox();
 		
 		return b;
 	}
@@ -128,11 +124,15 @@ namespace forge
 	// Try to move this method near the other place<>() methods.
 	template<> void Board::place<pieces::Empty>(BoardSquare square, bool isWhite)
 	{
-		m_whites[square] = 0;	// Both are necessary
-		m_blacks[square] = 0;	// Both are necessary
-		m_bishops[square] = 0;
-		m_rooks[square] = 0;
-		m_pawns[square] = 0;
+		const BitBoard keep = ~BitBoard::square(square);
+
+		m_whites &= keep;	// Both are necessary
+		m_blacks &= keep;	// Both are necessary
+		m_bishops &= keep;
+		m_rooks &= keep;
+		m_pawns &= keep;
+
+		m_mailbox[square.val()] = pieces::empty;
 	}
 
 	// ---------------------- MOVE METHODS (both push moves and captures) -----
@@ -145,6 +145,7 @@ namespace forge
 		m_rooks[move.to()] = 0;
 		m_pawns[move.to()] = 0;
 		m_whiteKing = move.to();
+		m_mailbox[move.to().val()] = pieces::whiteKing;
 
 		place<pieces::Empty>(move.from(), true);
 	}
@@ -157,6 +158,7 @@ namespace forge
 		m_rooks[move.to()] = 0;
 		m_pawns[move.to()] = 0;
 		m_blackKing = move.to();
+		m_mailbox[move.to().val()] = pieces::blackKing;
 
 		place<pieces::Empty>(move.from(), true);
 	}
@@ -177,10 +179,12 @@ namespace forge
 		if (this->isWhite(move.from())) {
 			m_whiteKing = move.to();
 			m_whites[move.to()] = 1;
+			m_mailbox[move.to().val()] = pieces::whiteKing;
 		}
 		else {
 			m_blackKing = move.to();
 			m_blacks[move.to()] = 1;
+			m_mailbox[move.to().val()] = pieces::blackKing;
 		}
 
 		place<pieces::Empty>(move.from(), true);
@@ -188,11 +192,17 @@ namespace forge
 
 	template<> void Board::move<pieces::QBN_Piece>(Move move)
 	{
-		m_whites[move.to()] = m_whites[move.from()];
-		m_blacks[move.to()] = m_blacks[move.from()];
-		m_bishops[move.to()] = m_bishops[move.from()];
-		m_rooks[move.to()] = m_rooks[move.from()];
-		m_pawns[move.to()] = m_pawns[move.from()];
+		// Copies the bit at 'from' to 'to' in each BitBoard
+		const uint8_t from = move.from().val();
+		const uint8_t to = move.to().val();
+		const BitBoard keep = ~BitBoard::square(to);
+
+		m_whites = (m_whites & keep) | BitBoard{ ((m_whites.bits() >> from) & 1) << to };
+		m_blacks = (m_blacks & keep) | BitBoard{ ((m_blacks.bits() >> from) & 1) << to };
+		m_bishops = (m_bishops & keep) | BitBoard{ ((m_bishops.bits() >> from) & 1) << to };
+		m_rooks = (m_rooks & keep) | BitBoard{ ((m_rooks.bits() >> from) & 1) << to };
+		m_pawns = (m_pawns & keep) | BitBoard{ ((m_pawns.bits() >> from) & 1) << to };
+		m_mailbox[to] = m_mailbox[from];
 
 		place<pieces::Empty>(move.from(), true);
 	}
@@ -226,6 +236,7 @@ namespace forge
 		m_bishops[move.to()] = 0;
 		m_rooks[move.to()] = 0;
 		m_pawns[move.to()] = 1;
+		m_mailbox[move.to().val()] = pieces::whitePawn;
 
 		// TODO: Enpassent
 
@@ -239,6 +250,7 @@ namespace forge
 		m_bishops[move.to()] = 0;
 		m_rooks[move.to()] = 0;
 		m_pawns[move.to()] = 1;
+		m_mailbox[move.to().val()] = pieces::blackPawn;
 
 		// TODO: Enpassent
 
@@ -291,14 +303,29 @@ namespace forge
 
 	void Board::placePiece(BoardSquare square, pieces::Piece piece)
 	{
+		if (piece.isKing()) {
+			// Kings are never removed, only moved. Their old square is emptied.
+			BoardSquare & king = (piece.isWhite() ? m_whiteKing : m_blackKing);
+
+			if (king != square) {
+				place<pieces::Empty>(king);
+			}
+
+			king = square;
+		}
+		else if (isKing(square)) {
+			// Can't remove or replace a King
+			return;
+		}
+
+		m_mailbox[square.val()] = (piece.isEmpty() ? pieces::empty : piece);
+
 		if (piece.isEmpty()) {
 			m_whites[square] = 0;
 			m_blacks[square] = 0;
 			m_bishops[square] = 0;
 			m_rooks[square] = 0;
 			m_pawns[square] = 0;
-	
-			// Do not worry about removing the King, we can't do that anyway
 		}
 		else {
 			if (piece.isWhite()) {
@@ -330,19 +357,11 @@ namespace forge
 				m_rooks[square] = 1;
 				m_pawns[square] = 0;
 			}
-			else if (piece.isKnight()) {
+			else if (piece.isKnight() || piece.isKing()) {
 				m_bishops[square] = 0;
 				m_rooks[square] = 0;
 				m_pawns[square] = 0;
 			}
-			else if (piece.isKing()) {
-				if (piece.isWhite()) {
-					m_whiteKing = square;
-				}
-				else {
-					m_blackKing = square;
-				}
-			}
 		}
 	}
 	
@@ -369,6 +388,8 @@ namespace forge
 
 		m_blackKing = BoardSquare{ 0, 4 };
 		m_whiteKing = BoardSquare{ 7, 4 };
+
+		updateMailbox();
 		
 		return;
 	}
@@ -397,6 +418,7 @@ namespace forge
 
 	template<> void Board::place<pieces::Queen>(BoardSquare square, bool isWhite)
 	{
+		m_mailbox[square.val()] = (isWhite ? pieces::whiteQueen : pieces::blackQueen);
 		m_whites[square] = isWhite;
 		m_blacks[square] = !isWhite;
 		m_bishops[square] = 1;
@@ -406,15 +428,17 @@ namespace forge
 
 	template<> void Board::place<pieces::Bishop>(BoardSquare square, bool isWhite)
 	{
+		m_mailbox[square.val()] = (isWhite ? pieces::whiteBishop : pieces::blackBishop);
 		m_whites[square] = isWhite;
 		m_blacks[square] = !isWhite;
 		m_bishops[square] = 1;
-		//m_rooks[square] = 0;
-		//m_pawns[square] = 0;
+		m_rooks[square] = 0;
+		m_pawns[square] = 0;
 	}
 
 	template<> void Board::place<pieces::Knight>(BoardSquare square, bool isWhite)
 	{
+		m_mailbox[square.val()] = (isWhite ? pieces::whiteKnight : pieces::blackKnight);
 		m_whites[square] = isWhite;
 		m_blacks[square] = !isWhite;
 		m_bishops[square] = 0;
@@ -424,6 +448,7 @@ namespace forge
 
 	template<> void Board::place<pieces::Rook>(BoardSquare square, bool isWhite)
 	{
+		m_mailbox[square.val()] = (isWhite ? pieces::whiteRook : pieces::blackRook);
 		m_whites[square] = isWhite;
 		m_blacks[square] = !isWhite;
 		m_bishops[square] = 0;
@@ -433,6 +458,7 @@ namespace forge
 
 	template<> void Board::place<pieces::Pawn>(BoardSquare square, bool isWhite)
 	{
+		m_mailbox[square.val()] = (isWhite ? pieces::whitePawn : pieces::blackPawn);
 		m_whites[square] = isWhite;
 		m_blacks[square] = !isWhite;
 		m_bishops[square] = 0;
@@ -443,6 +469,7 @@ namespace forge
 	template<> void Board::place<pieces::WhitePawn>(BoardSquare square, bool isWhite)
 	{
 		// isWhite is irrelevent
+		m_mailbox[square.val()] = pieces::whitePawn;
 		m_whites[square] = 1;
 		m_blacks[square] = 0;
 		m_bishops[square] = 0;
@@ -453,6 +480,7 @@ namespace forge
 	template<> void Board::place<pieces::BlackPawn>(BoardSquare square, bool isWhite)
 	{
 		// isWhite is irrelevent
+		m_mailbox[square.val()] = pieces::blackPawn;
 		m_whites[square] = 0;
 		m_blacks[square] = 1;
 		m_bishops[square] = 0;
@@ -9,14 +9,16 @@
 #include <guten/color/Color.h>
 #include <guten/boards/CheckerBoard.h>
 
+#include <array>
 #include <iostream>
 #include <vector>
 #include <tuple>
+#include <type_traits>
 #include <assert.h>	// for assert() // TODO: dO WE STILL need this
 
 namespace forge
 {
-	const BitBoard pawn_mask = 0x00FFFFFFFFFFFF00ULL;
+	constexpr BitBoard pawn_mask = 0x00FFFFFFFFFFFF00ULL;
 
 	class Board
 	{
@@ -44,8 +46,9 @@ namespace forge
 			const termcolor::Color & lightCell = guten::color::darkyellow,
 			const termcolor::Color & darkCell = guten::color::green) const;
 
-		pieces::Piece at(int row, int col) const;
-		pieces::Piece at(BoardSquare square) const;
+		pieces::Piece at(int row, int col) const { return at(BoardSquare{ row, col }); }
+		// Single lookup into the mailbox.
+		pieces::Piece at(BoardSquare square) const { return m_mailbox[square.val()]; }
 
 		// If piece == empty, does not remove King.
 		// To move King, simply set the desired coordinates using this method.
@@ -53,7 +56,9 @@ namespace forge
 		// Use methods that move pieces instead
 		void placePiece(uint8_t row, uint8_t col, pieces::Piece piece) { placePiece(BoardSquare((uint16_t)row, (uint16_t)col), piece); }
 		// If piece == empty, does not remove King.
+		// Kings can't be replaced either. Placing any other piece on a King does nothing.
 		// To move King, simply set the desired coordinates using this method.
+		// Its old square is emptied.
 		// Optimization: Not intended to be used in performance critical code.
 		// Use methods that move pieces instead
 		void placePiece(BoardSquare square, pieces::Piece piece);
@@ -124,6 +129,8 @@ namespace forge
 		BitBoard blacks() const { return m_blacks; }
 		BitBoard pawns() const { return m_pawns & pawn_mask; }
 		BitBoard en_passent() const { return m_pawns & ~pawn_mask; }
+		// Overwrites en passent bits. Only ranks 1 and 8 of 'enPassent' are used.
+		void en_passent(BitBoard enPassent) { m_pawns = (m_pawns & pawn_mask) | (enPassent & ~pawn_mask); }
 		BitBoard rooks() const { return m_rooks & ~m_bishops; }
 		BitBoard bishops() const { return m_bishops & ~m_rooks; }
 		BitBoard queens() const { return m_rooks & m_bishops; }
@@ -132,25 +139,14 @@ namespace forge
 		BitBoard rays() const { return m_rooks | m_bishops; }
 		BitBoard blockers() const { return occupied() & ~kings(); }
 		BitBoard knights() const {
-			BitBoard knightsBB =
+			return
 				occupied() &
 				~pawns() &
 				~m_bishops &
-				~m_rooks;
-
-			knightsBB[m_whiteKing] = 0;
-			knightsBB[m_blackKing] = 0;
-
-			return knightsBB;
-		}
-		BitBoard kings() const {
-			BitBoard kingsBB;
-
-			kingsBB[m_whiteKing] = 1;
-			kingsBB[m_blackKing] = 1;
-
-			return kingsBB;
+				~m_rooks &
+				~kings();
 		}
+		BitBoard kings() const { return BitBoard::square(m_whiteKing) | BitBoard::square(m_blackKing); }
 
 		BoardSquare whiteKing() const { return m_whiteKing; }
 		BoardSquare blackKing() const { return m_blackKing; }
@@ -198,9 +194,34 @@ namespace forge
 		BoardSquare m_whiteKing{ 60 };
 		BoardSquare m_blackKing{ 4 };
 
+		// Piece on each square. Indexed by BoardSquare::val()
+		// Redundant with the BitBoards above. Every method that changes the BitBoards 
+		// also updates it so that at() is a single load instead of a series of BitBoard tests.
+		// Only the Kings are on the Board by default.
+		std::array<pieces::Piece, 64> m_mailbox = kingsOnlyMailbox();
+
 		// TODO: Still need castiling
+
+		// Mailbox of a default constructed Board
+		static constexpr std::array<pieces::Piece, 64> kingsOnlyMailbox()
+		{
+			std::array<pieces::Piece, 64> mailbox{};
+
+			mailbox[4] = pieces::blackKing;
+			mailbox[60] = pieces::whiteKing;
+
+			return mailbox;
+		}
+
+		// Rebuilds the mailbox from the BitBoards.
+		// Slow. Only for methods that rewrite whole BitBoards at once.
+		void updateMailbox();
 	}; // class Board
 
+	// Boards are copied into every MovePositionPair and Position. Keep them plain data.
+	static_assert(std::is_standard_layout<Board>() && std::is_trivially_copyable<Board>(),
+		"Board must be standard layout and trivially copyable");
+
 	// -------------------------------- EXPLICIT SPECIALIZATIONS --------------
 
 } // namespace forge
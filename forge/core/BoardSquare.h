@@ -2,6 +2,7 @@
 
 #include <iostream>
 #include <string>
+#include <type_traits>
 
 namespace forge
 {
@@ -12,12 +13,12 @@ namespace forge
 		friend class BitBoard;	// Gives BitBoard access to m_val
 
 	public:
-		BoardSquare() = default;
-		BoardSquare(uint8_t val) :
+		constexpr BoardSquare() = default;
+		constexpr BoardSquare(uint8_t val) :
 			m_val(val) {}
-		BoardSquare(int row, int col) :
+		constexpr BoardSquare(int row, int col) :
 			m_val(col | (row << 3)) {}
-		BoardSquare(uint16_t row, uint16_t col) :
+		constexpr BoardSquare(uint16_t row, uint16_t col) :
 			m_val(col | (row << 3)) {}
 		// file: ['a' - 'h'] (case insensitive)
 		// rank: [ 1  -  8 ]
@@ -26,7 +27,7 @@ namespace forge
 		BoardSquare(const std::string& coord);
 		BoardSquare(const BoardSquare&) = default;
 		BoardSquare(BoardSquare&&) noexcept = default;
-		virtual ~BoardSquare() noexcept = default;
+		~BoardSquare() noexcept = default;
 		BoardSquare& operator=(const BoardSquare&) = default;
 		BoardSquare& operator=(BoardSquare&&) noexcept = default;
 		//BoardSquare & operator++(int) { ++m_val; }
@@ -35,8 +36,8 @@ namespace forge
 		//bool operator==(const BoardSquare & bs) const { return this->m_val == bs.m_val; }
 		//bool operator!=(const BoardSquare & bs) const { return this->m_val != bs.m_val; }
 
-		bool operator==(BoardSquare bs) const { return this->m_val == bs.m_val; }
-		bool operator!=(BoardSquare bs) const { return this->m_val != bs.m_val; }
+		constexpr bool operator==(BoardSquare bs) const { return this->m_val == bs.m_val; }
+		constexpr bool operator!=(BoardSquare bs) const { return this->m_val != bs.m_val; }
 
 		void fromString(const std::string& str);
 
@@ -55,12 +56,12 @@ namespace forge
 			m_val = col | (row << 3);
 		}
 
-		uint8_t row() const
+		constexpr uint8_t row() const
 		{
 			return m_val >> 3;		// shifts row bits while clearing col bits
 		}
 
-		uint8_t col() const
+		constexpr uint8_t col() const
 		{
 			return m_val & col_mask;	// clears masks row bits leaving col only
 		}
@@ -150,7 +151,7 @@ namespace forge
 		bool isKnight6InBounds() const { return row() <= 5 && col() <= 6; }
 		bool isKnight7InBounds() const { return row() <= 6 && col() <= 5; }
 
-		uint8_t val() const {
+		constexpr uint8_t val() const {
 			return m_val;
 		}
 
@@ -224,6 +225,11 @@ namespace forge
 		static const uint8_t row_mask = 0b00'111'000;	// Has 1's for each row bit
 		static const uint8_t is_invalid_mask = 0b01'000'000;
 	};
+
+	// Stored in every Board, Move and Position. Must stay a plain byte that can be memcpy'd.
+	static_assert(std::is_standard_layout<BoardSquare>() && std::is_trivially_copyable<BoardSquare>(),
+		"BoardSquare must be standard layout and trivially copyable");
+	static_assert(sizeof(BoardSquare) == 1, "BoardSquare must be 1 byte");
 } // namespace forge
 
 namespace std
@@ -0,0 +1,105 @@
+#include "forge/core/CpuFeatures.h"
+
+#if !defined(_MSC_VER) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#endif
+
+using namespace std;
+
+namespace forge
+{
+	namespace
+	{
+		// Registers returned by one CPUID query
+		struct CpuidRegs
+		{
+			uint32_t eax = 0;
+			uint32_t ebx = 0;
+			uint32_t ecx = 0;
+			uint32_t edx = 0;
+		};
+
+		// Returns false when 'leaf' is not supported or when not running on x86.
+		bool cpuid(uint32_t leaf, uint32_t subleaf, CpuidRegs & regs)
+		{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+			int info[4];
+			__cpuid(info, 0);
+			if (static_cast<uint32_t>(info[0]) < leaf) return false;
+
+			__cpuidex(info, leaf, subleaf);
+			regs.eax = info[0];
+			regs.ebx = info[1];
+			regs.ecx = info[2];
+			regs.edx = info[3];
+			return true;
+#elif defined(__x86_64__) || defined(__i386__)
+			return __get_cpuid_count(leaf, subleaf, &regs.eax, &regs.ebx, &regs.ecx, &regs.edx) != 0;
+#else
+			(void)leaf; (void)subleaf; (void)regs;
+			return false;
+#endif
+		}
+
+		// Returns the bits of extended control register 0 (which register states the OS saves).
+		// Only call when CPUID reports OSXSAVE.
+		uint64_t xgetbv0()
+		{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+			return _xgetbv(0);
+#elif defined(__x86_64__) || defined(__i386__)
+			uint32_t eax;
+			uint32_t edx;
+			asm("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+			return (uint64_t(edx) << 32) | eax;
+#else
+			return 0;
+#endif
+		}
+	} // namespace
+
+	const CpuFeatures::Features & CpuFeatures::features()
+	{
+		static const Features f = detect();
+
+		return f;
+	}
+
+	CpuFeatures::Features CpuFeatures::detect()
+	{
+		Features f;
+
+#if defined(__x86_64__) || defined(_M_X64)
+		CpuidRegs regs;
+
+		// Leaf 7: Structured extended features. BMI2 is bit 8 of EBX. AVX2 is bit 5 of EBX.
+		bool avx2 = false;
+		if (cpuid(7, 0, regs)) {
+			f.bmi2 = (regs.ebx >> 8) & 1;
+			avx2 = (regs.ebx >> 5) & 1;
+		}
+
+		// Leaf 0: Vendor string ("AuthenticAMD" is stored as EBX, EDX, ECX)
+		// Leaf 1: Family. AMD reports base family 0xF and the rest in the extended family.
+		CpuidRegs vendor;
+		CpuidRegs version;
+		bool isAmd = false;
+		uint32_t family = 0;
+
+		if (cpuid(0, 0, vendor) && cpuid(1, 0, version)) {
+			isAmd = (vendor.ebx == 0x68747541 && vendor.edx == 0x69746e65 && vendor.ecx == 0x444d4163);
+			family = ((version.eax >> 8) & 0xF) + ((version.eax >> 20) & 0xFF);
+		}
+
+		// Zen 3 (family 0x19) is the first AMD CPU with PEXT in hardware
+		f.fastPext = f.bmi2 && (isAmd == false || family >= 0x19);
+
+		// AVX2 is only usable when the OS saves the YMM registers (OSXSAVE is bit 27 of ECX,
+		// XCR0 bits 1 and 2 are the SSE and AVX states).
+		const bool osxsave = (version.ecx >> 27) & 1;
+		f.avx2 = avx2 && osxsave && (xgetbv0() & 0x6) == 0x6;
+#endif
+
+		return f;
+	}
+} // namespace forge
\ No newline at end of file
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+namespace forge
+{
+	// Instruction set extensions of the CPU we are running on.
+	// Queried once at runtime (CPUID) so that a single build of forgelib can use
+	// the fastest code each machine supports and fall back to portable code elsewhere.
+	// Always false on CPUs that are not x86-64.
+	class CpuFeatures
+	{
+	public:
+		// True iff the CPU supports BMI2 (PEXT, PDEP, ...)
+		static bool hasBmi2() { return features().bmi2; }
+
+		// True iff the CPU supports BMI2 and runs PEXT in hardware.
+		// AMD CPUs before Zen 3 support PEXT but emulate it in microcode which is
+		// slower than the portable code it would replace.
+		static bool hasFastPext() { return features().fastPext; }
+
+		// True iff the CPU supports AVX2 and the OS saves 256-bit registers on context switches.
+		static bool hasAvx2() { return features().avx2; }
+
+		// Parallel bit extract: packs the bits of 'src' selected by 'mask' into the low bits of the result.
+		// Only call when hasBmi2() is true.
+		static uint64_t pext(uint64_t src, uint64_t mask)
+		{
+#if defined(_MSC_VER) && defined(_M_X64)
+			return _pext_u64(src, mask);
+#elif defined(__x86_64__)
+			// Inline asm instead of _pext_u64() so that callers don't need to be compiled with -mbmi2.
+			uint64_t result;
+			asm("pextq %2, %1, %0" : "=r"(result) : "r"(src), "r"(mask));
+			return result;
+#else
+			(void)src; (void)mask;
+			return 0;	// Unreachable: hasBmi2() is always false here
+#endif
+		}
+
+	private:
+		struct Features
+		{
+			bool bmi2 = false;
+			bool fastPext = false;
+			bool avx2 = false;
+		};
+
+		// Detected on first call
+		static const Features & features();
+
+		static Features detect();
+	};
+} // namespace forge
\ No newline at end of file
@@ -1,11 +1,124 @@
 #pragma once
 
 #include "forge/core/BoardSquare.h"
+#include "forge/core/BitBoardTables.h"
 
 namespace forge
 {
 	namespace directions
 	{
+		// --- Direction Indices ---
+		// Directions as plain integers. They can be stored and passed around at runtime for free
+		// and everything about them is a lookup into the constexpr tables below.
+		// The classes further down are only compile time tags. Each one knows its index.
+		// Rays come first in the same order as tables::rays. Opposite rays are next to each other.
+		enum direction_t : uint8_t {
+			UP = tables::UP,
+			DOWN = tables::DOWN,
+			LEFT = tables::LEFT,
+			RIGHT = tables::RIGHT,
+			UP_LEFT = tables::UP_LEFT,
+			DOWN_RIGHT = tables::DOWN_RIGHT,
+			UP_RIGHT = tables::UP_RIGHT,
+			DOWN_LEFT = tables::DOWN_LEFT,
+			KNIGHT_0,
+			KNIGHT_1,
+			KNIGHT_2,
+			KNIGHT_3,
+			KNIGHT_4,
+			KNIGHT_5,
+			KNIGHT_6,
+			KNIGHT_7,
+			N_DIRECTIONS,
+		};
+
+		namespace detail
+		{
+			// Row (axis 0) or col (axis 1) step of each direction.
+			// Taken from the same steps as the BitBoard tables so that the two never disagree.
+			constexpr std::array<int8_t, N_DIRECTIONS> genSteps(int axis)
+			{
+				std::array<int8_t, N_DIRECTIONS> steps{};
+
+				for (int dir = 0; dir < N_DIRECTIONS; dir++) {
+					steps[dir] = (dir < KNIGHT_0 ? tables::RAY_DELTAS[dir][axis] : tables::KNIGHT_DELTAS[dir - KNIGHT_0][axis]);
+				}
+
+				return steps;
+			}
+
+			constexpr std::array<int8_t, N_DIRECTIONS> genDeltas()
+			{
+				std::array<int8_t, N_DIRECTIONS> deltas{};
+				const std::array<int8_t, N_DIRECTIONS> verticals = genSteps(0);
+				const std::array<int8_t, N_DIRECTIONS> horizontals = genSteps(1);
+
+				for (int dir = 0; dir < N_DIRECTIONS; dir++) {
+					deltas[dir] = verticals[dir] * 8 + horizontals[dir];
+				}
+
+				return deltas;
+			}
+
+			constexpr std::array<uint64_t, N_DIRECTIONS> genSources()
+			{
+				std::array<uint64_t, N_DIRECTIONS> sources{};
+				const std::array<int8_t, N_DIRECTIONS> verticals = genSteps(0);
+				const std::array<int8_t, N_DIRECTIONS> horizontals = genSteps(1);
+
+				for (int dir = 0; dir < N_DIRECTIONS; dir++) {
+					for (int square = 0; square < 64; square++) {
+						int row = square / 8 + verticals[dir];
+						int col = square % 8 + horizontals[dir];
+
+						if (row >= 0 && row < 8 && col >= 0 && col < 8) sources[dir] |= uint64_t{ 1 } << square;
+					}
+				}
+
+				return sources;
+			}
+		} // namespace detail
+
+		// Rows and cols moved by 1 step in each direction. Row 0 is the top of the board.
+		constexpr std::array<int8_t, N_DIRECTIONS> VERTICALS = detail::genSteps(0);
+		constexpr std::array<int8_t, N_DIRECTIONS> HORIZONTALS = detail::genSteps(1);
+
+		// How far the index of a square changes after 1 step in each direction.
+		// ex: BoardSquare{ square.val() + DELTAS[UP] } is the square above 'square'
+		constexpr std::array<int8_t, N_DIRECTIONS> DELTAS = detail::genDeltas();
+
+		// Squares that can take 1 step in each direction without leaving the board.
+		constexpr std::array<uint64_t, N_DIRECTIONS> SOURCES = detail::genSources();
+
+		constexpr direction_t opposite(direction_t dir) {
+			// Knight directions are 4 apart from their opposites
+			return direction_t(dir < KNIGHT_0 ? dir ^ 1 : KNIGHT_0 + ((dir - KNIGHT_0 + 4) & 7));
+		}
+
+		constexpr bool isRay(direction_t dir) { return dir < KNIGHT_0; }
+		constexpr bool isKnight(direction_t dir) { return dir >= KNIGHT_0; }
+		constexpr bool isLateral(direction_t dir) { return dir <= RIGHT; }
+		constexpr bool isDiagonal(direction_t dir) { return dir >= UP_LEFT && dir <= DOWN_LEFT; }
+
+		constexpr bool wouldBeInBounds(BoardSquare square, direction_t dir) {
+			return (SOURCES[dir] >> square.val()) & 1;
+		}
+
+		// Square 1 step away from 'square'. 'square' must be able to take that step.
+		// See wouldBeInBounds()
+		constexpr BoardSquare move(BoardSquare square, direction_t dir) {
+			return BoardSquare{ uint8_t(square.val() + DELTAS[dir]) };
+		}
+
+		// Moves every bit 1 step in 'dir'. Bits that would leave the board are dropped.
+		constexpr uint64_t shift(uint64_t bits, direction_t dir) {
+			bits &= SOURCES[dir];
+
+			return DELTAS[dir] > 0 ? bits << DELTAS[dir] : bits >> -DELTAS[dir];
+		}
+
+		// --- Direction Classes ---
+
 		class Direction {
 		public:
 			Direction() = default;
@@ -102,6 +215,8 @@ namespace forge
 			}
 
 			static std::string str() { return "Up"; }
+
+			static constexpr direction_t index = UP;
 		};
 
 		class Down : public virtual Vertical, public virtual Lateral, public virtual Ray {
@@ -128,6 +243,8 @@ namespace forge
 			}
 
 			static std::string str() { return "Down"; }
+
+			static constexpr direction_t index = DOWN;
 		};
 
 		class Left : public virtual Horizontal, public virtual Lateral, public virtual Ray {
@@ -154,6 +271,8 @@ namespace forge
 			}
 
 			static std::string str() { return "Left"; }
+
+			static constexpr direction_t index = LEFT;
 		};
 
 		class Right : public virtual Horizontal, public virtual Lateral, public virtual Ray {
@@ -180,6 +299,8 @@ namespace forge
 			}
 
 			static std::string str() { return "Right"; }
+
+			static constexpr direction_t index = RIGHT;
 		};
 
 		// --- Diagonal Rays: UL, UR, DL, DR ---
@@ -208,6 +329,8 @@ namespace forge
 			}
 
 			static std::string str() { return "UL"; }
+
+			static constexpr direction_t index = UP_LEFT;
 		};
 
 		class UR : public virtual OffDiagonal, public virtual Diagonal, public virtual Ray {
@@ -234,6 +357,8 @@ namespace forge
 			}
 
 			static std::string str() { return "UR"; }
+
+			static constexpr direction_t index = UP_RIGHT;
 		};
 
 		class DL : public virtual OffDiagonal, public virtual Diagonal, public virtual Ray {
@@ -260,6 +385,8 @@ namespace forge
 			}
 
 			static std::string str() { return "DL"; }
+
+			static constexpr direction_t index = DOWN_LEFT;
 		};
 
 		class DR : public virtual MainDiagonal, public virtual Diagonal, public virtual Ray {
@@ -286,6 +413,8 @@ namespace forge
 			}
 
 			static std::string str() { return "DR"; }
+
+			static constexpr direction_t index = DOWN_RIGHT;
 		};
 
 		// --- L-Shaped Directions: Knight Moves --- 
@@ -311,6 +440,8 @@ namespace forge
 			}
 
 			static std::string str() { return "Knight0"; }
+
+			static constexpr direction_t index = KNIGHT_0;
 		};
 
 		class Knight1 : public LShape {
@@ -334,6 +465,8 @@ namespace forge
 			}
 
 			static std::string str() { return "Knight1"; }
+
+			static constexpr direction_t index = KNIGHT_1;
 		};
 
 		class Knight2 : public LShape {
@@ -357,6 +490,8 @@ namespace forge
 			}
 
 			static std::string str() { return "Knight2"; }
+
+			static constexpr direction_t index = KNIGHT_2;
 		};
 
 		class Knight3 : public LShape {
@@ -380,6 +515,8 @@ namespace forge
 			}
 
 			static std::string str() { return "Knight3"; }
+
+			static constexpr direction_t index = KNIGHT_3;
 		};
 
 		class Knight4 : public LShape {
@@ -403,6 +540,8 @@ namespace forge
 			}
 
 			static std::string str() { return "Knight4"; }
+
+			static constexpr direction_t index = KNIGHT_4;
 		};
 
 		class Knight5 : public LShape {
@@ -426,6 +565,8 @@ namespace forge
 			}
 
 			static std::string str() { return "Knight5"; }
+
+			static constexpr direction_t index = KNIGHT_5;
 		};
 
 		class Knight6 : public LShape {
@@ -449,6 +590,8 @@ namespace forge
 			}
 
 			static std::string str() { return "Knight6"; }
+
+			static constexpr direction_t index = KNIGHT_6;
 		};
 
 		class Knight7 : public LShape {
@@ -472,6 +615,8 @@ namespace forge
 			}
 
 			static std::string str() { return "Knight7"; }
+
+			static constexpr direction_t index = KNIGHT_7;
 		};
 
 		// --- Checks if two BoardSquares are in some direction ---
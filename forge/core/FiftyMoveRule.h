@@ -39,7 +39,7 @@ namespace forge
 
 		int count() const { return halfMoveCount; }
 
-		void count(int halfMoveCount) { halfMoveCount = this->halfMoveCount; }
+		void count(int halfMoveCount) { this->halfMoveCount = halfMoveCount; }
 
 	private:
 		// Counts the number of half moves since the last time a:
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <assert.h>
+#include <cstring>		// for std::memcpy()
+
+#include <memory>		// for std::uninitialized_copy(), std::destroy()
+#include <new>			// for placement new
+#include <type_traits>
+#include <utility>
+
+namespace forge
+{
+	// Vector with a fixed capacity whose elements live inside the object itself.
+	// Never allocates, so it can be created on the stack or reused as a member for free.
+	// Elements are only constructed when pushed. Constructing an empty FixedVector costs nothing
+	// no matter how large CAPACITY is.
+	// Pushing past CAPACITY is a bug. It is only caught in Debug mode.
+	template<typename T, size_t CAPACITY>
+	class FixedVector
+	{
+	public:
+		using value_type = T;
+		using size_type = size_t;
+		using reference = T &;
+		using const_reference = const T &;
+		using iterator = T *;
+		using const_iterator = const T *;
+
+		FixedVector() = default;
+		FixedVector(const FixedVector & other) { copyFrom(other); }
+		FixedVector(FixedVector && other) noexcept { moveFrom(other); }
+		~FixedVector() noexcept { clear(); }
+		FixedVector & operator=(const FixedVector & other) {
+			if (this != &other) {
+				clear();
+				copyFrom(other);
+			}
+			return *this;
+		}
+		FixedVector & operator=(FixedVector && other) noexcept {
+			if (this != &other) {
+				clear();
+				moveFrom(other);
+			}
+			return *this;
+		}
+
+		// --- Capacity ---
+
+		size_t size() const { return m_size; }
+		bool empty() const { return m_size == 0; }
+		bool full() const { return m_size == CAPACITY; }
+		static constexpr size_t capacity() { return CAPACITY; }
+
+		// --- Element Access ---
+
+		T * data() { return reinterpret_cast<T *>(m_storage); }
+		const T * data() const { return reinterpret_cast<const T *>(m_storage); }
+
+		T & operator[](size_t i) { return data()[i]; }
+		const T & operator[](size_t i) const { return data()[i]; }
+
+		T & front() { return data()[0]; }
+		const T & front() const { return data()[0]; }
+
+		T & back() { return data()[m_size - 1]; }
+		const T & back() const { return data()[m_size - 1]; }
+
+		iterator begin() { return data(); }
+		iterator end() { return data() + m_size; }
+		const_iterator begin() const { return data(); }
+		const_iterator end() const { return data() + m_size; }
+		const_iterator cbegin() const { return begin(); }
+		const_iterator cend() const { return end(); }
+
+		// --- Modifiers ---
+
+		void push_back(const T & value) { emplace_back(value); }
+		void push_back(T && value) { emplace_back(std::move(value)); }
+
+		template<typename... ARGS>
+		T & emplace_back(ARGS &&... args)
+		{
+			assert(m_size < CAPACITY);
+
+			T * p = new (data() + m_size) T(std::forward<ARGS>(args)...);
+			m_size++;
+
+			return *p;
+		}
+
+		void pop_back()
+		{
+			m_size--;
+			if constexpr (std::is_trivially_destructible<T>() == false) {
+				data()[m_size].~T();
+			}
+		}
+
+		void clear()
+		{
+			if constexpr (std::is_trivially_destructible<T>() == false) {
+				std::destroy(begin(), end());
+			}
+			m_size = 0;
+		}
+
+	private:
+		// Only the live elements are copied. Trivially copyable elements are copied in bulk.
+		// This object must be empty.
+		void copyFrom(const FixedVector & other)
+		{
+			if constexpr (std::is_trivially_copyable<T>()) {
+				std::memcpy(m_storage, other.m_storage, other.m_size * sizeof(T));
+			}
+			else {
+				std::uninitialized_copy(other.begin(), other.end(), begin());
+			}
+			m_size = other.m_size;
+		}
+
+		void moveFrom(FixedVector & other)
+		{
+			if constexpr (std::is_trivially_copyable<T>()) {
+				std::memcpy(m_storage, other.m_storage, other.m_size * sizeof(T));
+			}
+			else {
+				std::uninitialized_move(other.begin(), other.end(), begin());
+			}
+			m_size = other.m_size;
+		}
+
+		// Uninitialized storage. Only the first 'm_size' elements are alive.
+		alignas(T) unsigned char m_storage[CAPACITY * sizeof(T)];
+
+		size_t m_size = 0;
+	};
+} // namespace forge
\ No newline at end of file
@@ -9,23 +9,22 @@ namespace forge
 {
 	void GameState::operator()(const game_history & history)
 	{
-		// Calculate number of legal moves
+		// Is there atleast one legal move?
 		MoveGenerator2 movegen;
-		MoveList legals = movegen.generate(history.current().position);
-		//MoveList legals = MoveGenerator::generateLegalMoves(history.current());
+		bool hasLegalMove = movegen.hasLegalMove(history.current().position);
 
 		function<bool()> drawByRepetition = [&]() {
 			return GameState::isDrawByRepetition(history);
 		};
 		
 		calcGameState(
-			legals.size(),					// Number of legal moves
+			hasLegalMove,					// Is there atleast one legal move
 			history.current().position,		// current position
 			std::move(drawByRepetition));	// calculates draw by repetition using a GameHistory
 	}
 
 	void GameState::calcGameState(
-		int nLegalMoves, 
+		bool hasLegalMove, 
 		const Position & currPos,
 		std::function<bool()>&& drawByRepetition)
 	{
@@ -44,11 +43,11 @@ namespace forge
 		bool wasWhitesTurn = !position.moveCounter().isWhitesTurn();
 
 		// --- Player can't move (WINS or DRAWS) ---
-		if (nLegalMoves == 0) {
+		if (hasLegalMove == false) {
 			// There are no valid moves for current player. It is either a WIN or DRAW
 			if (wasWhitesTurn) {
 				// --- WAS WHITE'S TURN (Now BLACK) ---
-				if (AttackChecker::isAttacked(board, board.m_blackKing)) {
+				if (position.attacks(WHITE)[board.m_blackKing]) {
 					// Blacks's King is attacked and can't move.
 					// White wins
 					this->player = PLAYER::WHITE;
@@ -66,7 +65,7 @@ namespace forge
 			}
 			else {
 				// --- WAS BLACK'S TURN (NOW WHITE) ---
-				if (AttackChecker::isAttacked(board, board.m_whiteKing)) {
+				if (position.attacks(BLACK)[board.m_whiteKing]) {
 					// Whites's King is attacked and can't move.
 					// Black wins
 					this->player = PLAYER::BLACK;
@@ -93,14 +93,14 @@ namespace forge
 	private:
 		// Calculates state of game as in: white wins, black wins, draw or continue.
 		// params:
-		//	- nLegalMoves - Number of legal moves at currPos
+		//	- hasLegalMove - Does the current player have atleast one legal move at currPos
 		//	- currPos - current position game
 		//	- drawByRepetition - function that calculates a draw by repetition.
 		//		Function will need to contain in some way allToFen the moves or positions
 		//		that lead to currPos, and return true if currPos has been found in 
 		//		game history atleast 3 times (actually 2 times not counting 'currPos'
 		//		itself.
-		void calcGameState(int nLegalMoves, const Position& currPos, std::function<bool()>&& drawByRepetition);
+		void calcGameState(bool hasLegalMove, const Position& currPos, std::function<bool()>&& drawByRepetition);
 
 		template<class NODE_T>
 		static bool isDrawByRepetition(const NodeTemplate<NODE_T>& node);
@@ -144,14 +144,14 @@ namespace forge
 //		}
 //#endif
 		MoveGenerator2 gen;
-		MoveList moves = gen.generate(node.position());
+		bool hasLegalMove = gen.hasLegalMove(node.position());
 		
 		std::function<bool()> drawByRepetition = [&]() {
 			return GameState::isDrawByRepetition(node);
 		};
 
 		calcGameState(
-			moves.size(),//node.children().size(),			// Number of legal moves
+			hasLegalMove,//node.children().size(),		// Is there atleast one legal move
 			node.position(),				// current position
 			std::move(drawByRepetition));	// calculates draw by repetition using a Node tree
 	}
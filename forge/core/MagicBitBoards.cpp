@@ -0,0 +1,143 @@
+#include "forge/core/MagicBitBoards.h"
+
+using namespace std;
+
+namespace forge
+{
+	namespace
+	{
+		// Magic multipliers for each square. Index is BoardSquare::val().
+		// Found offline by random search for this library's square numbering (a8 = 0, h1 = 63).
+		const uint64_t ROOK_MAGIC_NUMBERS[64] = {
+			0x5080002040008010ULL, 0x0040100040002000ULL, 0x0a00100881214200ULL, 0x2080080004100080ULL,
+			0x0200102108040200ULL, 0x0900010048240002ULL, 0x108040800d002200ULL, 0x0200004824088902ULL,
+			0x040080086680400cULL, 0x0420804000200080ULL, 0x0001004020001100ULL, 0x6041000a20100100ULL,
+			0x0048800400800800ULL, 0x0000800200040080ULL, 0x8001010004020001ULL, 0x2661001040a20100ULL,
+			0x8020208004400481ULL, 0x1010104000200041ULL, 0x2220008010002082ULL, 0x2010018008001080ULL,
+			0x1002020020081004ULL, 0x8404008004800200ULL, 0x0d00040010080102ULL, 0x0008020000512084ULL,
+			0x5408400980038524ULL, 0x0d00200040401000ULL, 0x0550100b80200080ULL, 0x0080220900100100ULL,
+			0x4016000600201008ULL, 0x000100030008a400ULL, 0x0000280400014210ULL, 0x1014208a00111044ULL,
+			0x0000401820800080ULL, 0x00c0100020200801ULL, 0x0620014802401000ULL, 0x1001001001002008ULL,
+			0x8000804402800800ULL, 0x2000800401801200ULL, 0x0001381204001001ULL, 0x0f06055c02000081ULL,
+			0x5080018040018022ULL, 0x1040003008006000ULL, 0x0400410020010011ULL, 0x080300100221000cULL,
+			0x0082000804220010ULL, 0x0004204010080104ULL, 0x84a0020110840008ULL, 0x0080229441020004ULL,
+			0x0250800028410500ULL, 0x0601104000842300ULL, 0x0400100020008080ULL, 0x2000084200201200ULL,
+			0x0000040008008280ULL, 0x5002000410080200ULL, 0x4140010822108400ULL, 0x000100088a004100ULL,
+			0x0002001108402082ULL, 0x0002001289204102ULL, 0x00240a1020820042ULL, 0x1000042100100009ULL,
+			0x4411000204100801ULL, 0x0042000108100402ULL, 0x0840101102280884ULL, 0x0110602400810042ULL
+		};
+
+		const uint64_t BISHOP_MAGIC_NUMBERS[64] = {
+			0x0808200102002100ULL, 0x1028011c04224000ULL, 0x8210188220400100ULL, 0x8024070600440424ULL,
+			0x1002021000000000ULL, 0x04120242e0080400ULL, 0x0a04120814060000ULL, 0x0000402808080400ULL,
+			0x0040041032081502ULL, 0x1183084808a08200ULL, 0x000008020c002800ULL, 0x4040a44402800010ULL,
+			0x0400011040000010ULL, 0x8001151402400032ULL, 0x0001050406134082ULL, 0x0000002088041004ULL,
+			0x0084004210820200ULL, 0x0110002002008122ULL, 0xc012050408120008ULL, 0x0081000820420032ULL,
+			0x0800800408a01000ULL, 0x000200a08801280cULL, 0x8040402c14040402ULL, 0x0401400204520800ULL,
+			0x0003180141081807ULL, 0x0004204104012402ULL, 0x3428010908061020ULL, 0x0010040020401020ULL,
+			0x0041004084004048ULL, 0x0054024000882000ULL, 0x108082000101101aULL, 0x0202004004840080ULL,
+			0x020422c00160a44cULL, 0x0408b0040a080809ULL, 0x3102002200302280ULL, 0x00000808000a0a00ULL,
+			0x8108020400141100ULL, 0x421004002001100cULL, 0x11045088a0040400ULL, 0x80bc008a08612100ULL,
+			0x4812025040218400ULL, 0x26822201045aa048ULL, 0x20240c0402000400ULL, 0x0000a22018040104ULL,
+			0x08000a022c000200ULL, 0x008418a281020200ULL, 0x2102240408a02414ULL, 0x0084490202210210ULL,
+			0x0001011011048011ULL, 0x2201420601213420ULL, 0x00000420a4100101ULL, 0x0000801042020160ULL,
+			0x0002401102020200ULL, 0x000048b001820000ULL, 0x0010420204140048ULL, 0x0048028c14102000ULL,
+			0x2840820101414004ULL, 0x4500020082080204ULL, 0x0080080041044100ULL, 0xa000012088208820ULL,
+			0x0004000020042400ULL, 0x0000004024444c22ULL, 0x2000040408082100ULL, 0x9004082081040100ULL
+		};
+
+		// Total number of attack sets over all 64 squares.
+		// Sum of 2^(bits in relevance mask) for each square.
+		const size_t ROOK_TABLE_SIZE = 102400;
+		const size_t BISHOP_TABLE_SIZE = 5248;
+
+		uint64_t rookTable[ROOK_TABLE_SIZE];
+		uint64_t bishopTable[BISHOP_TABLE_SIZE];
+
+		// Slowly computes attacks of a slider by walking each ray square by square.
+		// Only used to fill the tables.
+		// deltas - row and col steps of each ray of the slider.
+		// isMask - when true, excludes the last square of each ray (edge of the board)
+		//	and ignores 'occupied'. Used to compute the relevance mask of a square.
+		uint64_t slowAttacks(int square, uint64_t occupied, const int (&deltas)[4][2], bool isMask)
+		{
+			uint64_t attacks = 0;
+
+			for (const auto & delta : deltas) {
+				int row = (square >> 3) + delta[0];
+				int col = (square & 7) + delta[1];
+
+				while (row >= 0 && row < 8 && col >= 0 && col < 8) {
+					int nextRow = row + delta[0];
+					int nextCol = col + delta[1];
+					bool isLast = !(nextRow >= 0 && nextRow < 8 && nextCol >= 0 && nextCol < 8);
+
+					if (isMask && isLast) break;	// Edge squares can't block anything
+
+					uint64_t bit = uint64_t(1) << ((row << 3) | col);
+					attacks |= bit;
+
+					if (occupied & bit) break;		// Ray is blocked
+
+					row = nextRow;
+					col = nextCol;
+				}
+			}
+
+			return attacks;
+		}
+
+		const int ROOK_DELTAS[4][2] = { { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
+		const int BISHOP_DELTAS[4][2] = { { -1, -1 }, { -1, 1 }, { 1, -1 }, { 1, 1 } };
+	} // namespace
+
+	MagicBitBoards::Magic MagicBitBoards::rookMagics[64];
+	MagicBitBoards::Magic MagicBitBoards::bishopMagics[64];
+	bool MagicBitBoards::usePext = false;
+
+	void MagicBitBoards::initMagics(
+		Magic(&magics)[64],
+		const uint64_t(&magicNumbers)[64],
+		uint64_t * table,
+		const int(&deltas)[4][2])
+	{
+		uint64_t * next = table;
+
+		for (int square = 0; square < 64; square++) {
+			Magic & m = magics[square];
+
+			m.mask = slowAttacks(square, 0, deltas, true);
+			m.magic = magicNumbers[square];
+			m.table = next;
+			m.shift = static_cast<uint8_t>(64 - BitBoard(m.mask).count());
+
+			// Enumerate every subset of the mask (Carry-Rippler trick)
+			// and store its attack set at its index (magic or PEXT).
+			uint64_t occupied = 0;
+			do {
+				next[m.index(occupied)] = slowAttacks(square, occupied, deltas, false);
+
+				occupied = (occupied - m.mask) & m.mask;
+			} while (occupied);
+
+			next += (size_t(1) << (64 - m.shift));
+		}
+	}
+
+	void MagicBitBoards::init()
+	{
+		// Must be known before filling the tables. Each backend stores attack sets in a different order.
+		usePext = CpuFeatures::hasFastPext();
+
+		initMagics(rookMagics, ROOK_MAGIC_NUMBERS, rookTable, ROOK_DELTAS);
+		initMagics(bishopMagics, BISHOP_MAGIC_NUMBERS, bishopTable, BISHOP_DELTAS);
+	}
+
+	// Fills the tables before main() is entered.
+	struct MagicBitBoardsInitializer
+	{
+		MagicBitBoardsInitializer() { MagicBitBoards::init(); }
+	};
+
+	static MagicBitBoardsInitializer magicBitBoardsInitializer;
+} // namespace forge
\ No newline at end of file
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "forge/core/BitBoard.h"
+#include "forge/core/BoardSquare.h"
+#include "forge/core/CpuFeatures.h"
+#include "forge/core/Direction.h"
+
+#include <stdint.h>
+#include <type_traits>
+
+namespace forge
+{
+	// Attack tables for sliding pieces (Rooks, Bishops and Queens).
+	// Maps the square of a slider and the occupancy of the board to the set of squares
+	// that slider attacks with a single table lookup instead of walking each ray one square
+	// at a time.
+	//
+	// Only the squares that can block a ray matter (edges of the board can't block anything),
+	// so occupancy is masked down to those "relevant" squares. The masked occupancy is then
+	// multiplied by a "magic" number which packs its bits into the top bits of the product.
+	// Those bits are the index into the attack table of that square.
+	// See: https://www.chessprogramming.org/Magic_Bitboards
+	//
+	// On CPUs with fast BMI2 (See CpuFeatures) the multiply is replaced by a single PEXT
+	// which packs the masked occupancy into an index directly. The backend is picked once at
+	// startup and both use tables of the same size.
+	//
+	// Attack sets include the first piece (of either color) that blocks each ray.
+	// Attack sets never include the square the slider stands on.
+	// Tables are filled once during static initialization.
+	class MagicBitBoards
+	{
+	public:
+		// Squares attacked by a Rook standing on 'square'.
+		// occupied - Squares of any pieces that can block the Rook.
+		static BitBoard rookAttacks(BoardSquare square, BitBoard occupied)
+		{
+			return rookMagics[square.val()].attacks(occupied);
+		}
+
+		// Squares attacked by a Bishop standing on 'square'.
+		// occupied - Squares of any pieces that can block the Bishop.
+		static BitBoard bishopAttacks(BoardSquare square, BitBoard occupied)
+		{
+			return bishopMagics[square.val()].attacks(occupied);
+		}
+
+		// Squares attacked by a Queen standing on 'square'.
+		// occupied - Squares of any pieces that can block the Queen.
+		static BitBoard queenAttacks(BoardSquare square, BitBoard occupied)
+		{
+			return rookAttacks(square, occupied) | bishopAttacks(square, occupied);
+		}
+
+		// Squares attacked from 'square' in a single ray direction.
+		// Includes the first piece the ray hits.
+		// RAY_DIRECTION_T - ex: Up, Down, UL, DR. See Direction.h
+		template<typename RAY_DIRECTION_T>
+		static BitBoard rayAttacks(BoardSquare square, BitBoard occupied);
+
+		// True iff attack tables are indexed with PEXT instead of magic multiplication.
+		static bool usesPext() { return usePext; }
+
+	private:
+		// Everything needed to find the attack set of one square.
+		struct Magic
+		{
+			// Squares that can block the slider. Excludes edges of the board.
+			uint64_t mask;
+
+			// Multiplier that maps every subset of 'mask' to a unique index.
+			uint64_t magic;
+
+			// Attack sets of this square indexed by index().
+			const uint64_t * table;
+
+			// 64 - number of bits in 'mask'
+			uint8_t shift;
+
+			size_t index(BitBoard occupied) const
+			{
+				if (usePext) return static_cast<size_t>(CpuFeatures::pext(occupied.bits(), mask));
+
+				return static_cast<size_t>(((occupied.bits() & mask) * magic) >> shift);
+			}
+
+			BitBoard attacks(BitBoard occupied) const { return table[index(occupied)]; }
+		};
+
+		static Magic rookMagics[64];
+		static Magic bishopMagics[64];
+
+		// Selects the backend. Set once by init() before the tables are filled.
+		static bool usePext;
+
+		// Fills both tables. Called once during static initialization.
+		static void init();
+
+		// Fills the tables of one slider type.
+		// deltas - row and col steps of each ray of the slider.
+		static void initMagics(
+			Magic(&magics)[64],
+			const uint64_t(&magicNumbers)[64],
+			uint64_t * table,
+			const int(&deltas)[4][2]);
+
+		friend struct MagicBitBoardsInitializer;
+	};
+
+	// -------------------------------- METHOD DEFINITIONS --------------------
+
+	template<typename RAY_DIRECTION_T>
+	BitBoard MagicBitBoards::rayAttacks(BoardSquare square, BitBoard occupied)
+	{
+		static_assert(std::is_base_of<directions::Ray, RAY_DIRECTION_T>(),
+			"RAY_DIRECTION_T must be a ray direction like forge::directions::Up or forge::directions::UL");
+
+		// Attacks in every direction, limited to the squares of this one ray
+		if constexpr (std::is_base_of<directions::Lateral, RAY_DIRECTION_T>()) {
+			return rookAttacks(square, occupied) & BitBoard::mask<RAY_DIRECTION_T>(square);
+		}
+		else {
+			return bishopAttacks(square, occupied) & BitBoard::mask<RAY_DIRECTION_T>(square);
+		}
+	}
+} // namespace forge
\ No newline at end of file
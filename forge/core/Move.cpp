@@ -109,13 +109,16 @@ namespace forge
 			char toRank = input.at(3);
 			char prom = input.at(4);
 
-			move.promotion(prom);
+			move.promotion(pieces::empty);
+
+			move.from(fromFile, fromRank);
 
 			if (move.isValid()) {
-				move.from(fromFile, fromRank);
+				move.to(toFile, toRank);
 
+				// Needs 'to' to know which color the promotion is
 				if (move.isValid()) {
-					move.to(toFile, toRank);
+					move.promotion(prom);
 				}
 			}
 		}
@@ -177,18 +180,57 @@ namespace forge
 #endif
 		}
 
-		// Set color of piece
-		if (this->to().isTopRank()) {
-			p.makeWhite();
+		this->promotion(p);
+
+		// Pawns only promote on the top and bottom ranks.
+		// The color of the piece is determined by which one.
+		if (p.isOccupied() && this->to().isTopRank() == false && this->to().isBotRank() == false) {
+			this->setInvalid();
 		}
-		else if (this->to().isBotRank()) {
-			p.makeBlack();
+	}
+
+	namespace
+	{
+		// Promotion pieces in the order of their 2-bit codes
+		const pieces::Piece::piece_t promotionPieces[4] = {
+			pieces::Piece::KNIGHT,
+			pieces::Piece::BISHOP,
+			pieces::Piece::ROOK,
+			pieces::Piece::QUEEN,
+		};
+	} // namespace
+
+	pieces::Piece Move::promotion() const
+	{
+		if (isPromotion() == false) return pieces::empty;
+
+		pieces::Piece p{ promotionPieces[(m_val & promotion_mask) >> 12] };
+
+		// White Pawns promote on the top rank, Black Pawns on the bottom rank
+		if (to().isBotRank()) p.makeBlack();
+
+		return p;
+	}
+
+	void Move::promotion(pieces::Piece piece)
+	{
+		uint16_t code = 0;
+
+		if (piece.isQueen())		code = 3;
+		else if (piece.isRook())	code = 2;
+		else if (piece.isBishop())	code = 1;
+		else if (piece.isKnight())	code = 0;
+		else if (piece.isPawn()) {
+			setInvalid();
+			return;
 		}
 		else {
-			this->setInvalid();
+			// Empty (or a King): Not a promotion
+			m_val &= ~(flag_mask | promotion_mask);
+			return;
 		}
 
-		this->promotion(p);
+		m_val = (m_val & ~(flag_mask | promotion_mask)) | (PROMOTION << 14) | (code << 12);
 	}
 
 	string Move::toLAN() const
@@ -210,6 +252,6 @@ namespace forge
 	
 	size_t Move::hash() const
 	{
-		return std::hash<std::bitset<16>>{}(m_val);
+		return std::hash<uint16_t>{}(m_val);
 	}
 } // namespace forge
\ No newline at end of file
@@ -3,22 +3,31 @@
 #include "forge/core/BoardSquare.h"
 #include "forge/core/Piece.h"
 
-#include <bitset>
+#include <stdint.h>
+#include <type_traits>
 
 namespace forge
 {
-	const std::bitset<16> from_mask =      0b0000'000000'111111;
-	const std::bitset<16> to_mask =		   0b0000'111111'000000;
-	const std::bitset<16> promotion_mask = 0b1111'000000'000000;
-
 	class Move
 	{
 	public:
-		Move() = default;
-		Move(BoardSquare from, BoardSquare to) :
+		// Kind of move. Stored in the top 2 bits so make-move can tell special moves
+		// apart without looking at the Board.
+		enum Flag : uint8_t
+		{
+			NORMAL = 0,		// Push or capture
+			PROMOTION = 1,	// Pawn reaches its last rank. See promotion()
+			EN_PASSANT = 2,
+			CASTLING = 3,
+		};
+
+		constexpr Move() = default;
+		constexpr Move(BoardSquare from, BoardSquare to) :
 			m_val((to.val() << 6) | from.val()) {}
 		Move(BoardSquare from, BoardSquare to, pieces::Piece promotion) :
-			m_val((promotion.val().to_ulong() << 12) | (to.val() << 6) | (from.val())) {}
+			Move(from, to) { this->promotion(promotion); }
+		constexpr Move(BoardSquare from, BoardSquare to, Flag flag) :
+			m_val((flag << 14) | (to.val() << 6) | from.val()) {}
 		// Constructs move based on string
 		// string can be stored in PGN or LAN notation
 		Move(const std::string & notation);
@@ -28,21 +37,23 @@ namespace forge
 		Move & operator=(const Move &) = default;
 		Move & operator=(Move &&) noexcept = default;
 
-		bool operator==(const Move & rhs) const { return m_val == rhs.m_val; }
-		bool operator!=(const Move & rhs) const { return !(*this == rhs); }
+		constexpr bool operator==(const Move & rhs) const { return m_val == rhs.m_val; }
+		constexpr bool operator!=(const Move & rhs) const { return !(*this == rhs); }
 
-		BoardSquare from() const 
-		{
-			uint16_t v = (uint16_t) (m_val & from_mask).to_ulong();
+		// All 16 bits. See m_val
+		constexpr uint16_t val() const { return m_val; }
 
-			return BoardSquare((uint8_t) v);
-		}
+		// Same as from().val() and to().val(). Range: [0, 63]
+		constexpr uint8_t fromIndex() const { return m_val & from_mask; }
+		constexpr uint8_t toIndex() const { return (m_val & to_mask) >> 6; }
+
+		constexpr Flag flag() const { return Flag(m_val >> 14); }
+
+		constexpr BoardSquare from() const { return BoardSquare{ fromIndex() }; }
 		
 		void from(BoardSquare pos) 
 		{
-			std::bitset<16> posBits = pos.val() /*<< 0*/;
-
-			m_val = (m_val & ~from_mask) | posBits;
+			m_val = (m_val & ~from_mask) | pos.val();
 		}
 		
 		// Sets to component using file and rank as characters
@@ -53,18 +64,11 @@ namespace forge
 		// !!! Only use characters not integers
 		void from(char file, char rank);
 
-		BoardSquare to() const 
-		{
-			uint16_t v = (uint16_t) (m_val & to_mask).to_ulong() >> 6;
-
-			return BoardSquare((uint8_t) v);
-		}
+		constexpr BoardSquare to() const { return BoardSquare{ toIndex() }; }
 		
 		void to(BoardSquare pos) 
 		{
-			std::bitset<16> posBits = pos.val() << 6;
-
-			m_val = (m_val & ~to_mask) | posBits;
+			m_val = (m_val & ~to_mask) | (pos.val() << 6);
 		}
 
 		// Sets to component using file and rank as characters
@@ -75,15 +79,11 @@ namespace forge
 		// !!! Only use characters not integers
 		void to(char file, char rank);
 		
-		pieces::Piece promotion() const 
-		{
-			uint16_t v = (uint16_t) (m_val & promotion_mask).to_ulong() >> 12;
-
-			return pieces::Piece((uint8_t) v);
-		}
+		// Piece the Pawn promotes to or empty when this is not a promotion.
+		// Its color is that of the Pawns that promote on the rank of to().
+		pieces::Piece promotion() const;
 		
-		// Make sure piece is of the correct color
-		// and is any of:
+		// 'piece' is any of:
 		//	- Queen
 		//	- Rook
 		//	- Bishop
@@ -91,13 +91,9 @@ namespace forge
 		//	- Empty (Optional: Should be empty if Move does not represent a pawn promotion)
 		// and None of:
 		//	- King
-		//	- Pawn
-		void promotion(pieces::Piece piece)
-		{
-			std::bitset<16> promotionBits = piece.val().to_ullong() << 12;
-
-			m_val = (m_val & ~promotion_mask) | promotionBits;
-		}
+		//	- Pawn (Sets Move to invalid)
+		// The color of 'piece' is ignored.
+		void promotion(pieces::Piece piece);
 
 		// Sets promotion component to one cooresponding to 
 		// 'promotionCh'. 
@@ -119,20 +115,23 @@ namespace forge
 		// User selects 'e5'
 		// Game applies the move 'e4e5'
 		// When isPartial() returns true, to() and from() will be equal.
-		bool isPartial() const { return to() == from(); }
-		bool isPromotion() const { return promotion() != pieces::empty; }
+		constexpr bool isPartial() const { return toIndex() == fromIndex(); }
+		constexpr bool isPromotion() const { return flag() == PROMOTION; }
+		constexpr bool isEnPassant() const { return flag() == EN_PASSANT; }
+		constexpr bool isCastling() const { return flag() == CASTLING; }
 
 		// Used to determine if a specifed move has been set to invalid.
 		// Does not consider most cases of valid or invalid moves.
 		// A Move object must be set to invalid by calling .setInvalid() 
 		//	usually when user enters and invalid move.
-		bool isInvalid() const { return promotion().isPawn(); }
-		bool isValid() const { return !isInvalid(); }
+		constexpr bool isInvalid() const { return (m_val & invalid_mask) == invalid_mask; }
+		constexpr bool isValid() const { return !isInvalid(); }
 
-		// Used to identify a move as invalid by setting promotion component to a pawn.
+		// Used to identify a move as invalid by setting the flag and promotion bits to all 1s.
+		// (Castling never promotes so no real move looks like that.)
 		// When changing an Move set to invalid, be sure to set the promotion component
 		// as well.
-		void setInvalid() { promotion(pieces::whitePawn); }
+		void setInvalid() { m_val |= invalid_mask; }
 
 		//std::string toPGN(const Board & board) const;
 
@@ -161,9 +160,20 @@ namespace forge
 		friend std::istream & operator>>(std::istream & is, Move & move);
 
 	protected:
+		static const uint16_t from_mask =      0b00'00'000000'111111;
+		static const uint16_t to_mask =        0b00'00'111111'000000;
+		static const uint16_t promotion_mask = 0b00'11'000000'000000;
+		static const uint16_t flag_mask =      0b11'00'000000'000000;
+		static const uint16_t invalid_mask =   flag_mask | promotion_mask;
+
 		// bits 0...5	- from [ row (3-bits) ][ col (3-bits) ]
 		// bits 6...11	- to   [ row (3-bits) ][ col (3-bits) ]
-		// bits 12...15 - promotion [ piece val (4-bits) ]
-		std::bitset<16> m_val = 0;
+		// bits 12...13 - promotion [ 0: Knight, 1: Bishop, 2: Rook, 3: Queen ] (Only when flag is PROMOTION)
+		// bits 14...15 - flag (See Move::Flag)
+		uint16_t m_val = 0;
 	};
+
+	static_assert(std::is_standard_layout<Move>() && std::is_trivially_copyable<Move>(),
+		"Move must be standard layout and trivially copyable");
+	static_assert(sizeof(Move) == 2, "Move must be 2 bytes");
 } // namespace forge
\ No newline at end of file
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "forge/core/Move.h"
+
+#include <vector>
+
+namespace forge
+{
+	// Legal moves of many Positions stored in one flat buffer (CSR layout).
+	// The Moves of Position 'i' are moves[offsets[i]] up to (but excluding) moves[offsets[i + 1]].
+	// Filled by MoveGenerator2::generateBatch().
+	// Reuse the same MoveBatch for every batch. Its buffers keep their capacity so
+	// they stop allocating once they are large enough.
+	class MoveBatch
+	{
+	public:
+		// Number of Positions in the batch
+		size_t size() const { return (offsets.empty() ? 0 : offsets.size() - 1); }
+
+		bool empty() const { return size() == 0; }
+
+		// Number of legal moves of Position 'i'
+		size_t count(size_t i) const { return offsets[i + 1] - offsets[i]; }
+
+		// Range of the Moves of Position 'i'
+		const Move * begin(size_t i) const { return moves.data() + offsets[i]; }
+		const Move * end(size_t i) const { return moves.data() + offsets[i + 1]; }
+
+		void clear()
+		{
+			moves.clear();
+			offsets.clear();
+		}
+
+	public:
+		// Moves of every Position back to back
+		std::vector<Move> moves;
+
+		// Index into 'moves' of the first Move of each Position, plus the total number of moves at the end.
+		std::vector<size_t> offsets;
+	};
+} // namespace forge
\ No newline at end of file
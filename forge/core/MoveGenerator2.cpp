@@ -1,37 +1,76 @@
 #include "forge/core/MoveGenerator2.h"
+#include "forge/core/MagicBitBoards.h"
 
 using namespace std;
 
 namespace forge
 {
+	bool givesCheck(const Position& pos, Move move)
+	{
+		const Board& b = pos.board();
+		const bool isWhitesTurn = pos.isWhitesTurn();
+		const BitBoard ours = (isWhitesTurn ? b.whites() : b.blacks());
+		const BoardSquare theirKing = (isWhitesTurn ? b.blackKing() : b.whiteKing());
+		const BoardSquare from = move.from();
+		const BoardSquare to = move.to();
+
+		const BitBoard fromBB = BitBoard::square(from);
+		const BitBoard toBB = BitBoard::square(to);
+
+		// Piece that will stand on 'to'
+		const pieces::Piece piece = (move.isPromotion() ? move.promotion() : b.at(from));
+
+		// 1.) --- Direct checks from Knights and Pawns ---
+		if (piece.isKnight()) {
+			if (pieces::Knight::pushMask(to)[theirKing]) return true;
+		}
+		else if (piece.isPawn()) {
+			BitBoard captures = (isWhitesTurn ? pieces::WhitePawn::captureMask(to) : pieces::BlackPawn::captureMask(to));
+
+			if (captures[theirKing]) return true;
+		}
+
+		// 2.) --- Direct and discovered checks from Rays ---
+		// Look out from their King through the Board as it will be after the move.
+		// Any of our Rays it sees gives check. 
+		// Either the moved piece (direct) or one it stopped blocking (discovered).
+		BitBoard occupied = (b.occupied() & ~fromBB) | toBB;
+		BitBoard ourLaterals = ours & b.laterals() & ~fromBB;
+		BitBoard ourDiagonals = ours & b.diagonals() & ~fromBB;
+
+		if (piece.isRook() || piece.isQueen()) ourLaterals |= toBB;
+		if (piece.isBishop() || piece.isQueen()) ourDiagonals |= toBB;
+
+		return
+			(MagicBitBoards::rookAttacks(theirKing, occupied) & ourLaterals).any() ||
+			(MagicBitBoards::bishopAttacks(theirKing, occupied) & ourDiagonals).any();
+	}
+
 	void MoveGenerator2::reset()
 	{
-		(*this) = MoveGenerator2{};
+		// Every other field is overwritten by preprocess() and genLegalMoves()
+		legalMoves.clear();
+		legalMoveVector.clear();
+		nLegalMoves = 0;
+
+		ourAbsolutePins.reset();
+		checkers.reset();
 	}
 
+	template<color_t SIDE>
 	void MoveGenerator2::preprocess(const Position& position)
 	{
 		currPositionPtr = &position;
-		bool isWhitesTurn = position.moveCounter().isWhitesTurn();
 		const Board& b = position.board();
 
 		occupied = b.occupied();
 		empty = b.empty();
 
-		if (isWhitesTurn) {
-			ours = b.whites();
-			theirs = b.blacks();
-
-			ourKing = b.whiteKing();
-			theirKing = b.blackKing();
-		}
-		else {
-			ours = b.blacks();
-			theirs = b.whites();
+		ours = (SIDE == WHITE ? b.whites() : b.blacks());
+		theirs = (SIDE == WHITE ? b.blacks() : b.whites());
 
-			ourKing = b.blackKing();
-			theirKing = b.whiteKing();
-		}
+		ourKing = (SIDE == WHITE ? b.whiteKing() : b.blackKing());
+		theirKing = (SIDE == WHITE ? b.blackKing() : b.whiteKing());
 
 		ourRays = ours & b.rays();
 		theirRays = theirs & b.rays();
@@ -39,716 +78,360 @@ namespace forge
 		ourBlockers = ours & b.blockers();
 		theirBlockers = theirs & b.blockers();
 
-		// TODO: Don't think we need these
-		ourDiagonals = ours & b.diagonals();
 		theirDiagonals = theirs & b.diagonals();
-
-		// TODO: Don't think we need these
-		ourLaterals = ours & b.laterals();
 		theirLaterals = theirs & b.laterals();
 
-		threats = Threats::genThreats(b, theirs);
+		// Kept up to date by Position. See Position::attacks()
+		threats = position.attacks(!SIDE);
+
+		findPinsAndCheckers<SIDE>();
 	}
 
 	MoveList& MoveGenerator2::generate(const Position& pos)
 	{
-		reset();
-
-		preprocess(pos);
-
-		// Who if any are attacking our King?
-		KingAttackers attackers = KingAttackers::findKingAttackers(pos.board(), ourKing, theirs, ours);
+		genLegalMoves(pos, Mode::MOVE_POSITION_PAIRS);
 
-		// How many King attackers did we find?
-		if (attackers.size() <= 2) {
-			// 2 enemies are attacking our King
-			// All we can do is:
-			//	- King pushes to safety
-			//	- King captures one attacker (assuming its not defended)
+		return legalMoves;
+	}
 
-			// --- King Pushes to Safety ---
-			// --- King captures one attacker ---
-			genKingMoves();
+	MoveVector& MoveGenerator2::generateMoves(const Position& pos)
+	{
+		genLegalMoves(pos, Mode::MOVES_ONLY);
 
-			// TODO: OPTIMIZE: genKingMoves() should be called last.
-			// When sorting moves in order of best to worst, King moves will usually be last.
-		}
+		return legalMoveVector;
+	}
 
-		if (attackers.size() == 1) {
-			// 1 enemey is attacking our King
-			// All we can do is:
-			//	- See attackers.size() <= 2
-			//	- Non-King blocks attacker ***
-			//	- Non-King captures attacker ***
-			// *** Non-King pieces that are pinned to King can only move between pinner and our King
+	void MoveGenerator2::generateBatch(const Position* positions, size_t count, MoveBatch& batch)
+	{
+		batch.clear();
+		batch.offsets.reserve(count + 1);
+		batch.offsets.push_back(0);
 
-			// TODO: Find all pinned pieces here
-			genPinMoves(pos.board(), pos.moveCounter().isWhitesTurn(), true);
+		for (size_t i = 0; i < count; i++) {
+			genLegalMoves(positions[i], Mode::MOVES_ONLY);
 
-			// Must evaluate pinned peices before calling this method
-			genBlockAndCaptureMoves(attackers[0]);
+			batch.moves.insert(batch.moves.end(), legalMoveVector.begin(), legalMoveVector.end());
+			batch.offsets.push_back(batch.moves.size());
 		}
+	}
 
-		if (attackers.size() == 0) {
-			// Our King is safe from attackers
-			// We can do any move:
-			//	- Move Absolutely Pinned Pieces
-			//	- Move non-Pinned pieces
-
-			genPinMoves(pos.board(), pos.moveCounter().isWhitesTurn(), false);
+	MoveVector& MoveGenerator2::generateCaptures(const Position& pos)
+	{
+		genLegalMoves(pos, Mode::MOVES_ONLY, Filter::QUIESCENCE);
 
-			genFreeMoves();
-		}
+		return legalMoveVector;
+	}
 
-		///cout << "Absolute Pins: " << endl;
-		///for (uint8_t bit = 0; bit < 64; bit++) {
-		///	if (ourAbsolutePins[bit]) {
-		///		cout << BoardSquare{ bit } << ' ';
-		///	}
-		///}
-		///cout << endl;
+	MoveVector& MoveGenerator2::generateChecks(const Position& pos)
+	{
+		genLegalMoves(pos, Mode::MOVES_ONLY, Filter::CHECKS);
 
-		return legalMoves;
+		return legalMoveVector;
 	}
 
-	void MoveGenerator2::genPinMoves(const Board& b, bool isWhitesTurn, bool searchOnly)
+	size_t MoveGenerator2::count(const Position& pos)
 	{
-		// 1.) --- Starting from our King, search in each ray direction for pins ---
-		// Remember: Pins can only be delivered from Ray Pieces (Not knights, kings or pawns)
-
-		// --- Forward Checking ---
-		// Is there a possibility of a pin in some direction?
-		// If not, then there's no reason to perform an expensive pin search in that direction
-		// Is a pin possible in a diagonal direction?
-		if (isPinPossible<directions::Diagonal>()) {
-			// Yes, A diagonal pin is possible.
-			///cout << "Diagonal pin is possible\n";
-
-			// --- Break bs down further into individual ray directions ---
-			searchAndGeneratePins<directions::UR>(searchOnly);
-			searchAndGeneratePins<directions::UL>(searchOnly);
-			searchAndGeneratePins<directions::DL>(searchOnly);
-			searchAndGeneratePins<directions::DR>(searchOnly);
-		}
-		else {
-			///cout << "Diagonal pin NOT possible\n";
-		}
-
-		// Is a pin possible in a lateral direction?
-		if (isPinPossible<directions::Lateral>()) {
-			// Yes, A pin is possible.
-			///cout << "Lateral pin is possible\n";
+		genLegalMoves(pos, Mode::COUNT);
 
-			// --- Break bs down further into individual ray directions ---
-			searchAndGeneratePins<directions::Up>(searchOnly);
-			searchAndGeneratePins<directions::Down>(searchOnly);
-			searchAndGeneratePins<directions::Left>(searchOnly);
-			searchAndGeneratePins<directions::Right>(searchOnly);
-		}
-		else {
-			///cout << "Lateral pin NOT possible\n";
-		}
+		return nLegalMoves;
 	}
 
-	// !!!WARNING: Make sure move is in bounds before calling this function.
-	// Does not perform bounds checking in Release Mode.
-	template<typename DIRECTION_T>
-	inline void moveKing(
-		MoveList& legals,
-		const BoardSquare& ourKing,
-		const BitBoard& open,	// Every square that is not occupied and not attacked
-		const Position& pos)
+	bool MoveGenerator2::hasLegalMove(const Position& pos)
 	{
-#ifdef _DEBUG
-		if (DIRECTION_T::wouldBeInBounds(ourKing) == false) {
-			cout << termcolor::push << termcolor::red
-				<< "Error: " << __FILE__ << " line " << __LINE__
-				<< " move is out of bounds.\n"
-				<< termcolor::pop;
-			return;
-		}
-#endif // _DEBUG
+		genLegalMoves(pos, Mode::ANY);
 
-		BoardSquare to = DIRECTION_T::move(ourKing);
+		return nLegalMoves > 0;
+	}
 
-		// Is move safe?
-		if (open[to]) {
-			// Yes bs is safe.
-			legals.emplace_back<pieces::King>(Move{ ourKing, to }, pos);
-		}
+	void MoveGenerator2::genLegalMoves(const Position& pos, Mode mode, Filter filter)
+	{
+		if (pos.isWhitesTurn())
+			genLegalMoves<WHITE>(pos, mode, filter);
+		else
+			genLegalMoves<BLACK>(pos, mode, filter);
 	}
 
-	void MoveGenerator2::genKingMoves()
+	template<color_t SIDE>
+	void MoveGenerator2::genLegalMoves(const Position& pos, Mode mode, Filter filter)
 	{
-		const Position& pos = *currPositionPtr;
-		const Board& board = pos.board();
-		const BitBoard open = ~(ours | threats);	// Squares that are not ours and not attacked
+		reset();
 
-		// --- Up ---
-		if (!ourKing.isTopRank()) {
-			// --- Left ---
-			if (!ourKing.isLeftFile()) {
-				moveKing<directions::UL>(legalMoves, ourKing, open, pos);
-			}
+		this->mode = mode;
+		this->filter = filter;
 
-			// --- Middle ---
-			{
-				moveKing<directions::Up>(legalMoves, ourKing, open, pos);
-			}
+		preprocess<SIDE>(pos);
 
-			// --- Right ---
-			if (!ourKing.isRightFile()) {
-				moveKing<directions::UR>(legalMoves, ourKing, open, pos);
-			}
+		switch (filter) {
+		case Filter::ALL:						targets = ~BitBoard{};	break;
+		case Filter::CAPTURES_AND_PROMOTIONS:
+		case Filter::QUIESCENCE:				targets = theirs;		break;
+		case Filter::QUIETS:					targets = ~theirs;		break;
+		case Filter::CHECKS:					targets = ~BitBoard{};	break;
 		}
 
-		// --- Middle ---
-		{
-			// --- Left ---
-			if (!ourKing.isLeftFile()) {
-				moveKing<directions::Left>(legalMoves, ourKing, open, pos);
-			}
+		checkMask = ~BitBoard{};
 
-			// --- Middle ---
-			{
-				// King stays where bs is. Nothing to do here.
-			}
+		if (filter == Filter::CHECKS) {
+			findDiscoverers();
+		}
 
-			// --- Right ---
-			if (!ourKing.isRightFile()) {
-				moveKing<directions::Right>(legalMoves, ourKing, open, pos);
-			}
+		// Every evasion is needed when in check. Not only the captures.
+		if (filter == Filter::QUIESCENCE && checkers.any()) {
+			this->filter = Filter::ALL;
+			targets = ~BitBoard{};
 		}
 
-		// --- Bottom ---
-		if (!ourKing.isBotRank()) {
+		// --- King Pushes to Safety ---
+		// --- King captures attackers ---
+		// Always possible no matter how many pieces attack our King.
+		genKingMoves<SIDE>();
 
-			// --- Left ---
-			if (!ourKing.isLeftFile()) {
-				moveKing<directions::DL>(legalMoves, ourKing, open, pos);
-			}
+		// King moves are the cheapest to find. Often that is all ANY mode needs.
+		if (mode == Mode::ANY && nLegalMoves > 0) return;
 
-			// --- Middle ---
-			{
-				moveKing<directions::Down>(legalMoves, ourKing, open, pos);
-			}
-
-			// --- Right ---
-			if (!ourKing.isRightFile()) {
-				moveKing<directions::DR>(legalMoves, ourKing, open, pos);
-			}
+		if (checkers.several()) {
+			// 2 enemies are attacking our King
+			// Only our King can move. Nothing can block or capture both attackers at once.
+			return;
 		}
-	}
 
-	// RAY_DIRECTION_T - Direction from 'victim' piece to an attacking Piece
-	// legals - MoveList that we are to generate moves into.
-	// victim - Square of the piece which we are trying to capture. (An empty square can be a "victim")
-	// aggressors - All pieces which can capture the victim square. (Exclude absolute pins)
-	// pos - Current Position of the game. Used to generate the next position.
-	template<typename RAY_DIRECTION_T>
-	inline void captureWithRay(
-		MoveList& legals,
-		const BoardSquare& victim,
-		const BitBoard& aggressors,
-		const Position& pos)
-	{
-		static_assert(std::is_base_of<directions::Ray, RAY_DIRECTION_T>(),
-			"Error: This function only works on Ray directions.");
+		if (checkers.any()) {
+			// 1 enemy is attacking our King
+			// Non-King pieces can only:
+			//	- block the attacker (Only Rays can be blocked)
+			//	- capture the attacker
+			// Pinned pieces can never do either so they are skipped.
+			checkMask = tables::between[ourKing.val()][checkers.lsb()] | checkers;
+			targets &= checkMask;
 
-		BoardSquare attacker = Attackers::findAttackingRay<RAY_DIRECTION_T>(victim, pos.board(), aggressors);
+			if (mode == Mode::ANY)
+				genAnyFreeMove<SIDE>();
+			else
+				genFreeMoves<SIDE>();
 
-		// If an attacker was found then apply capture move.
-		if (attacker.isValid()) {
-			// TODO: OPTIMIZE: Replace template param with pieces::RayPiece
-			// Move will be from 'attacker' to 'victim'
-			legals.emplace_back<pieces::Piece>(Move{ attacker, victim }, pos);
+			return;
 		}
-	}
 
-	// See comments for captureWithRay()
-	template<typename KNIGHT_DIRECTION_T>
-	inline void captureAttackerWithKnight(
-		MoveList& legals,
-		const BoardSquare& attacker,
-		const Position& pos,
-		const BitBoard& ourKnights)
-	{
-		static_assert(std::is_base_of<directions::LShape, KNIGHT_DIRECTION_T>(),
-			"Error: This function only works on Knight directions.");
+		// Our King is safe from attackers
+		// We can do any move:
+		//	- Move Absolutely Pinned Pieces (along their pin)
+		//	- Move non-Pinned pieces
+		if (mode == Mode::ANY) {
+			// Pinned pieces are the most expensive. Only look at their moves when nothing else can move.
+			genAnyFreeMove<SIDE>();
 
-		BoardSquare bs = Attackers::findAttackingKnight<KNIGHT_DIRECTION_T>(attacker, pos.board(), ourKnights);
+			if (nLegalMoves == 0) {
+				genPinMoves<SIDE>();
+			}
+		}
+		else {
+			genPinMoves<SIDE>();
 
-		// If an attacker was found and bs is not Absolutely Pinned,
-		// Apply capture move.
-		if (bs.isValid()) {
-			legals.emplace_back<pieces::Knight>(Move{ bs, attacker }, pos);
+			genFreeMoves<SIDE>();
 		}
 	}
 
-	void MoveGenerator2::genBlockAndCaptureMoves(const KingAttacker& attacker)
+	template<color_t SIDE>
+	void MoveGenerator2::findPinsAndCheckers()
 	{
-		const Position& pos = *currPositionPtr;
-		const Board& board = pos.board();
-		BitBoard pushMask;		// Where the attacker can push to (assuming no obstacles)
-		BitBoard captureMask;	// Where the attacker can capture (assuming no obstacles and a capturable piece exists)
-
-		// Generate push and capture masks that tell us where attacker can push and capture to
-		const pieces::Piece& attackerPiece = board.at(attacker.square);
-		attackerPiece.masks(attacker.square, pushMask, captureMask);
-
-		// Direction from our King to attacker.
-		// Could be a ray or knight direction.
-		const directions::Direction & dirToAttacker = attacker.dir;
-
-		BoardSquare bs;
-
-		// Is the attacker a Ray or non-Ray?
-		if (attackerPiece.isRay()) {
-			// --- Attacker is a Ray ---
-
-			// Yes. Because the attacker is Ray, it can be blocked and captured.
-
-			// TODO: Optimize: There is no need to search for blockers and capturers
-			// in direction of King because, those pieces would be taken care of as 
-			// pins.
-
-			// Move bs 1 square in direction of attacker.
-			bs = (dirToAttacker.wouldBeInBounds(ourKing) ? dirToAttacker.move(ourKing) : attacker.square);
-		} // end if(piece.isRay())
-		else {
-			// --- Attacker is either a Knight or Pawn ---
-			bs = attacker.square;
+		const Board& b = currPositionPtr->board();
+		const uint8_t king = ourKing.val();
+
+		// --- Checkers ---
+		// A piece attacks our King iff the same kind of piece standing on our King would attack it.
+		checkers =
+			(b.knights() & tables::knights[king]) |
+			(SideToMove<SIDE>::Pawn::captureMask(ourKing) & b.pawns()) |
+			(MagicBitBoards::rookAttacks(ourKing, occupied) & b.laterals()) |
+			(MagicBitBoards::bishopAttacks(ourKing, occupied) & b.diagonals());
+		checkers &= theirs;
+
+		// --- Pins ---
+		// X-ray from our King: Their Rays that would see our King on an empty board.
+		// When exactly 1 piece stands between such a Ray and our King, and that piece is ours,
+		// then it is pinned. (When nothing stands between them, the Ray is a checker.)
+		const BitBoard snipers =
+			(theirLaterals & tables::laterals[king]) |
+			(theirDiagonals & tables::diagonals[king]);
+
+		for (BoardSquare sniper : snipers) {
+			const BitBoard blockers = occupied & tables::between[king][sniper.val()];
+
+			if (blockers.any() && blockers.several() == false) ourAbsolutePins |= blockers & ours;
 		}
+	}
 
-		// Iterate from King's square to attacker and look for blocker/captures
-		while (true) {
-			// TODO: Optimize: We can probably replace bounds checking with attacker.square
-			// 'bs' will always reach attacker before edge of board.
-
-			// TODO: Optimize: We should probably have multiple loops. One loop for each type of piece.
-
-			// --- Find one of our pieces that can block/capture the attacker ---
-
-			// Find a piece that can move to this square and block the attacker.
-			// Hint: If a piece can 'attack' a square then bs can block/capture at that square.
+	void MoveGenerator2::findDiscoverers()
+	{
+		const Board& b = currPositionPtr->board();
+		const uint8_t king = theirKing.val();
 
-			// --- Block/Capture with our Laterals ---
-			{
-				BitBoard attackerCross = BitBoard::mask<directions::Lateral>(bs);
-				BitBoard aggressors = ourLaterals & attackerCross & ~ourAbsolutePins;
+		const BitBoard snipers = ours & (
+			(b.laterals() & tables::laterals[king]) |
+			(b.diagonals() & tables::diagonals[king]));
 
-				// Is bs possible that one of our Laterals can capture attacker?
-				if (aggressors.any()) {
-					// Yes. Look in more detail.
+		discoverers.reset();
 
-					captureWithRay<directions::Up>(legalMoves, bs, aggressors, pos);
-					captureWithRay<directions::Down>(legalMoves, bs, aggressors, pos);
-					captureWithRay<directions::Left>(legalMoves, bs, aggressors, pos);
-					captureWithRay<directions::Right>(legalMoves, bs, aggressors, pos);
-				}
-			}
+		for (BoardSquare sniper : snipers) {
+			const BitBoard blockers = occupied & tables::between[king][sniper.val()];
 
-			// --- Block/Capture with our Diagonals ---
-			{
-				BitBoard attackerX = BitBoard::mask<directions::Diagonal>(bs);
-				BitBoard aggressors = ourDiagonals & attackerX & ~ourAbsolutePins;
+			if (blockers.any() && blockers.several() == false) discoverers |= blockers & ours;
+		}
+	}
 
-				// Is bs possible that one of our Laterals can capture attacker?
-				if (aggressors.any()) {
-					// Yes. Look in more detail.
+	template<color_t SIDE>
+	void MoveGenerator2::genPinMoves()
+	{
+		const Board& b = currPositionPtr->board();
 
-					captureWithRay<directions::UR>(legalMoves, bs, aggressors, pos);
-					captureWithRay<directions::UL>(legalMoves, bs, aggressors, pos);
-					captureWithRay<directions::DR>(legalMoves, bs, aggressors, pos);
-					captureWithRay<directions::DL>(legalMoves, bs, aggressors, pos);
-				}
-			}
+		for (BoardSquare pinned : ourAbsolutePins) {
+			// Squares this piece can move to without exposing our King.
+			const BitBoard ray = pinRay(pinned);
+			const pieces::Piece p = b.at(pinned);
 
-			// --- Block/Capture with our Knights ---
-			{
-				BitBoard attackerOctopus = BitBoard::mask<directions::LShape>(bs);
-				BitBoard aggressors = board.knights() & ours & attackerOctopus & ~ourAbsolutePins;
-
-				// Is it possible that one of our Knights can capture the attacker?
-				if (aggressors.any()) {
-					// Yes. One or more of our Knights can capture attacker.
-
-					captureAttackerWithKnight<directions::Knight0>(legalMoves, bs, pos, aggressors);
-					captureAttackerWithKnight<directions::Knight1>(legalMoves, bs, pos, aggressors);
-					captureAttackerWithKnight<directions::Knight2>(legalMoves, bs, pos, aggressors);
-					captureAttackerWithKnight<directions::Knight3>(legalMoves, bs, pos, aggressors);
-					captureAttackerWithKnight<directions::Knight4>(legalMoves, bs, pos, aggressors);
-					captureAttackerWithKnight<directions::Knight5>(legalMoves, bs, pos, aggressors);
-					captureAttackerWithKnight<directions::Knight6>(legalMoves, bs, pos, aggressors);
-					captureAttackerWithKnight<directions::Knight7>(legalMoves, bs, pos, aggressors);
-				}
+			if (p.isPawn()) {
+				genPawnMoves<SIDE>(BitBoard::square(pinned), ray);
 			}
-
-			//// --- Block/Capture with our Pawns ---
-			//// --- Look for Captures from our Pawns ---
-			//genPawnBlockAndCapture(attacker, captureMask);
-
-			// --- Block/Capture with our Kings (Skip) ---
-			// King moves are taken care of in genKingMoves(). Nothing to do here.
-
-			// --- Did we reach the attacker? ---
-			if (bs == attacker.square) {
-				break; // Yes we have now found all block/capture moves.
+			else if (p.isRook()) {
+				addMoves<pieces::Rook>(pinned, MagicBitBoards::rookAttacks(pinned, occupied) & ~ours & ray);
 			}
-			else if (dirToAttacker.wouldBeInBounds(bs)) {	// TODO: OPTIMIZE: Is bounds checking necessary. The attacker will always be in bounds
-				bs = dirToAttacker.move(bs);	// Incremente 'bs' towards attacker
+			else if (p.isBishop()) {
+				addMoves<pieces::Bishop>(pinned, MagicBitBoards::bishopAttacks(pinned, occupied) & ~ours & ray);
 			}
-			else {
-#ifdef _DEBUG
-				cout << "Error: " << __FUNCTION__ << " line " << __LINE__
-					<< "\tThis line should never be reached. bs should hit the attacker and always stay inbounds." << endl;
-				throw std::exception("This line should never be reached");
-				cin.get();
-#endif // _DEBUG
-				break;
+			else if (p.isQueen()) {
+				addMoves<pieces::Queen>(pinned, MagicBitBoards::queenAttacks(pinned, occupied) & ~ours & ray);
 			}
-		} // end while (true) 
+			// Pinned Knights can never move. Kings are never pinned.
+		}
+	}
 
-		// --- Block/Capture with our Pawns ---
-		// --- Look for Captures from our Pawns ---
-		genPawnBlockAndCapture(attacker, captureMask);
+	template<color_t SIDE>
+	void MoveGenerator2::genKingMoves()
+	{
+		const BitBoard open = ~(ours | threats);	// Squares that are not ours and not attacked
+
+		addMoves<typename SideToMove<SIDE>::King>(ourKing, pieces::King::pushMask(ourKing) & open);
 	}
 
-	void MoveGenerator2::genPawnBlockAndCapture(const KingAttacker& attacker, BitBoard captureMask)
+	// -------------------------------- FREE MOVES ----------------------------
+
+	template<color_t SIDE>
+	void MoveGenerator2::genFreeMoves()
 	{
-		const Position& pos = *currPositionPtr;
-		const Board& board = pos.board();
-		pieces::Piece attackerPiece = board.at(attacker.square);
-		const directions::Direction& dirToAttacker = attacker.dir;
-
-//#ifdef _DEBUG
-//		// TODO: This method should work even against non-ray attackers
-//		if (attackerPiece.isRay() == false) {
-//			cout << "Error: " << __FUNCTION__ << "() is only ment to be called when attacker is a Ray"
-//				<< endl;
-//	}
-//#endif // _DEBUG
-
-		// Our pawns that might be able to block/capture attacker.
-		BitBoard usefullPawns = ours & board.pawns() & ~ourAbsolutePins;
-
-		directions::Direction dir1;	// Direction of blocking pawn that pushes 1 squares
-		directions::Direction dir2;	// Direction of blocking pawn that pushes 2 squares
-		directions::Direction dirL;	// Direction of capturing pawn that captures from left
-		directions::Direction dirR;	// Direction of capturing pawn that captures from right
-		uint8_t promotionRow;		// Promotional rank of pawn
-		uint8_t startingRow;		// Row a pawn starts on (and can push 2 squares)
-		pieces::Piece q;
-		pieces::Piece r;
-		pieces::Piece b;
-		pieces::Piece n;
-
-		// What is the color of Attacker? 
-		if (attackerPiece.isWhite()) {
-			// === Block/Capture with Black Pawn ===
-			dir1 = directions::Up{};
-			dir2 = directions::Direction{ -2, 0 };
-			dirL = directions::UL{};
-			dirR = directions::UR{};
-			promotionRow = 7;
-			startingRow = 1;
-
-			q = pieces::blackQueen;
-			r = pieces::blackRook;
-			b = pieces::blackBishop;
-			n = pieces::blackKnight;
-		}
-		else {
-			// === Block/Capture with White Pawn ===
-			dir1 = directions::Down{};
-			dir2 = directions::Direction{ 2, 0 };
-			dirL = directions::DL{};
-			dirR = directions::DR{};
-			promotionRow = 0;
-			startingRow = 6;
-
-			q = pieces::whiteQueen;
-			r = pieces::whiteRook;
-			b = pieces::whiteBishop;
-			n = pieces::whiteKnight;
-		}
+		const Board& b = currPositionPtr->board();
 
-		// TODO: Optimize: The commented part could save a lot of work
-		if (/*direction.isHorizontal() || direction.isDiagonal()*/ true) {
-			// Only need to search pawn pushes. No need to look for pawn captures.
-			// Iterate from king in the direction of attacker 
-			// And see if we can block the attacker.
-			// *** If attacker is a Knight or Pawn. ***
-			// *** Then this loop will break before the 1st iteration. ***
-			for (BoardSquare square = dirToAttacker.move(ourKing);
-				square != attacker.square;
-				square = dirToAttacker.move(square))
-			{
-				// === PUSH 1 ===
-				BoardSquare pawn1 = (dir1.wouldBeInBounds(square) ? dir1.move(square) : BoardSquare::invalid());
-
-				// Hint: square will always be empty because if it wasn't then an attack would not be possible
-				//					   No need to test for this vvvvvvvvvvvvv
-				if (pawn1.isValid() && usefullPawns[pawn1]/* && empty[square]*/) {
-					// Would push lead to promotion?
-					if (square.row() == promotionRow) {
-						// Yes promote pawn.
-						legalMoves.emplace_back<pieces::Pawn>(Move{ pawn1, square, q }, pos);
-						legalMoves.emplace_back<pieces::Pawn>(Move{ pawn1, square, r }, pos);
-						legalMoves.emplace_back<pieces::Pawn>(Move{ pawn1, square, b }, pos);
-						legalMoves.emplace_back<pieces::Pawn>(Move{ pawn1, square, n }, pos);
-					}
-					else {
-						// No Promotion. Just a push.
-						legalMoves.emplace_back<pieces::Pawn>(Move{ pawn1, square }, pos);
-					}
-				}
-
-				// === PUSH 2 ===
-				BoardSquare pawn2 = (dir2.wouldBeInBounds(square) ? dir2.move(square) : BoardSquare::invalid());
-				pawn2 = (
-					pawn2.isValid() &&				// Make sure pawn2 is on the board
-					empty[pawn1] &&					// Make sure pawn1 is empty (so that we don't jump another piece)
-					usefullPawns[pawn2] &&			// Make sure pawn2 is the square of a pawn we can use and not something else
-					pawn2.row() == startingRow ?	// Make sure pawn2 is a starting square where pawns can do double pushes
-					pawn2 :							// True: leave pawn2 with the same value
-					BoardSquare::invalid());		// False: make pawn2 invalid.
-
-				if (pawn2.isValid()) {
-					legalMoves.emplace_back<pieces::Pawn>(Move{ pawn2, square }, pos);
-				}
-			} // for (
-		} // if Horizontal or Diagonal
-		else if (dirToAttacker.isVertical()) {
-			// No need to search pawn pushes. Only look for pawn captures.
-		}
-		else {
-			// This line should never be reached
-#ifdef _DEBUG
-			throw std::exception("This line should never be reached");
-#endif
-		}
+		// --- Pawns (all at once) ---
+		genFreePawnMoves<SIDE>();
 
-		// --- Look for a Pawn that can CAPTURE attacker ---
+		// Pinned pieces had their moves generated by another function.
+		// Only visit our pieces that are not pinned.
+		for (BoardSquare cell : ours & ~ourAbsolutePins) {
+			pieces::Piece p = b.at(cell);
 
-		// --- LEFT Pawn Capture ---
-		BoardSquare pawnL = (dirL.wouldBeInBounds(attacker.square) ? dirL.move(attacker.square) : BoardSquare::invalid());
-		if (pawnL.isValid() && usefullPawns[pawnL]) {
-			if (pawnL.row() == promotionRow) {
-				legalMoves.emplace_back<pieces::Pawn>(Move{ pawnL, attacker.square, q }, pos);
-				legalMoves.emplace_back<pieces::Pawn>(Move{ pawnL, attacker.square, r }, pos);
-				legalMoves.emplace_back<pieces::Pawn>(Move{ pawnL, attacker.square, b }, pos);
-				legalMoves.emplace_back<pieces::Pawn>(Move{ pawnL, attacker.square, n }, pos);
+			// --- In order of most common to least common pieces
+			// Pawns were already generated above
+			if (p.isRook()) {
+				genFreeRookMoves(cell);
 			}
-			else {
-				legalMoves.emplace_back<pieces::Pawn>(Move{ pawnL, attacker.square }, pos);
+			else if (p.isBishop()) {
+				genFreeBishopMoves(cell);
 			}
-		}
-
-		// --- RIGHT Pawn Capture ---
-		BoardSquare pawnR = (dirR.wouldBeInBounds(attacker.square) ? dirR.move(attacker.square) : BoardSquare::invalid());
-		if (pawnR.isValid() && usefullPawns[pawnR]) {
-			if (pawnR.row() == promotionRow) {
-				legalMoves.emplace_back<pieces::Pawn>(Move{ pawnR, attacker.square, q }, pos);
-				legalMoves.emplace_back<pieces::Pawn>(Move{ pawnR, attacker.square, r }, pos);
-				legalMoves.emplace_back<pieces::Pawn>(Move{ pawnR, attacker.square, b }, pos);
-				legalMoves.emplace_back<pieces::Pawn>(Move{ pawnR, attacker.square, n }, pos);
+			else if (p.isKnight()) {
+				genFreeKnightMoves(cell);
 			}
-			else {
-				legalMoves.emplace_back<pieces::Pawn>(Move{ pawnR, attacker.square }, pos);
+			else if (p.isQueen()) {
+				genFreeQueenMoves(cell);
 			}
+			/*else if (p.isKing()) {
+				// King moves are generated in another method
+				// Nothing to do here
+			}*/
 		}
-}
-
-	void MoveGenerator2::genLateralBlockAndCaptureRay(const KingAttacker& attacker, BitBoard captureMask)
-	{
-
 	}
 
-	void MoveGenerator2::genDiagonalBlockAndCaptureRay(const KingAttacker& attacker, BitBoard captureMask)
+	template<color_t SIDE>
+	void MoveGenerator2::genAnyFreeMove()
 	{
+		const Board& b = currPositionPtr->board();
+		const BitBoard unpinned = ours & ~ourAbsolutePins;
 
-	}
+		// --- Knights ---
+		for (BoardSquare knight : unpinned & b.knights()) {
+			genFreeKnightMoves(knight);
 
-	void MoveGenerator2::genKnightBlockAndCaptureRay(const KingAttacker& attacker, BitBoard captureMask)
-	{
+			if (nLegalMoves > 0) return;
+		}
 
-	}
+		// --- Pawns ---
+		genFreePawnMoves<SIDE>();
 
-	// -------------------------------- FREE MOVES ----------------------------
+		if (nLegalMoves > 0) return;
 
-	void MoveGenerator2::genFreeMoves()
-	{
-		const Board& b = currPositionPtr->board();
+		// --- Rays (Rooks, Bishops and Queens) ---
+		for (BoardSquare cell : unpinned & b.rays()) {
+			pieces::Piece p = b.at(cell);
 
-		for (uint8_t row = 0; row < 8; row++) {
-			for (uint8_t col = 0; col < 8; col++) {
-				BoardSquare cell{ row, col };
-
-				// Is this piece pinned? If so bs's moves would have been generated by another function.
-				if (ours[cell] && ourAbsolutePins[cell] == false) {
-					// This piece is not pinned, and therefore its moves have not been generated.
-
-					pieces::Piece p = b.at(cell);
-
-					// --- In order of most common to least common pieces
-					if (p.isPawn()) {
-						genFreePawnMoves(cell);
-					}
-					else if (p.isRook()) {
-						genFreeRookMoves(cell);
-					}
-					else if (p.isBishop()) {
-						genFreeBishopMoves(cell);
-					}
-					else if (p.isKnight()) {
-						genFreeKnightMoves(cell);
-					}
-					else if (p.isQueen()) {
-						genFreeQueenMoves(cell);
-					}
-					/*else if (p.isKing()) {
-						// King moves are generated in another method
-						// Nothing to do here
-					}*/
-				}
-			}
+			if (p.isRook())			genFreeRookMoves(cell);
+			else if (p.isBishop())	genFreeBishopMoves(cell);
+			else if (p.isQueen())	genFreeQueenMoves(cell);
+
+			if (nLegalMoves > 0) return;
 		}
 	}
 
-	void MoveGenerator2::genFreePawnMoves(BoardSquare pawn)
+	template<color_t SIDE>
+	void MoveGenerator2::genFreePawnMoves()
 	{
 		const Board& board = currPositionPtr->board();
-		const Position& pos = *currPositionPtr;
 
-#ifdef _DEBUG
-		if (board.isPawn(pawn) == false) {
-			cout << termcolor::push << termcolor::bright_red
-				<< "Error: " << __FILE__ << " line " << __LINE__
-				<< " " << pawn << " is a " << board.at(pawn) << " and not a pawn" << endl;
+		genPawnMoves<SIDE>(ours & board.pawns() & ~ourAbsolutePins, ~BitBoard{});
 	}
-#endif // _DEBUG
 
-		// TODO: OPTIMIZE: This whole function can be optimized 
-		// Break down into Black and White Pawns 
-
-		BoardSquare push1;
-		BoardSquare push2;
-		BoardSquare captLeft;
-		BoardSquare captRight;
-		uint8_t promotionRow;
-		pieces::Piece q;
-		pieces::Piece r;
-		pieces::Piece b;
-		pieces::Piece n;
-
-		if (board.isWhite(pawn)) {
-			// === White Pawn ===
-			push1 = pawn.upOne();
-			push2 = (pawn.row() == 6 ? pawn.up(2) : BoardSquare::invalid());
-			captLeft = (!pawn.isLeftFile() ? pawn.upLeftOne() : BoardSquare::invalid());
-			captRight = (!pawn.isRightFile() ? pawn.upRightOne() : BoardSquare::invalid());
-			promotionRow = 0;
-			q = pieces::whiteQueen;
-			r = pieces::whiteRook;
-			b = pieces::whiteBishop;
-			n = pieces::whiteKnight;
-		}
-		else {
-			// === Black Pawn ===
-			push1 = pawn.downOne();
-			push2 = (pawn.row() == 1 ? pawn.down(2) : BoardSquare::invalid());
-			captLeft = (!pawn.isLeftFile() ? pawn.downLeftOne() : BoardSquare::invalid());
-			captRight = (!pawn.isRightFile() ? pawn.downRightOne() : BoardSquare::invalid());
-			promotionRow = 7;
-			q = pieces::blackQueen;
-			r = pieces::blackRook;
-			b = pieces::blackBishop;
-			n = pieces::blackKnight;
-		}
+	template<color_t SIDE>
+	void MoveGenerator2::genPawnMoves(BitBoard pawns, BitBoard allowed)
+	{
+		using Side = SideToMove<SIDE>;
 
-		// === PUSH 1 ===
-		if (empty[push1]) {
-			if (push1.row() == promotionRow) {
-				legalMoves.emplace_back<pieces::Pawn>(Move{ pawn, push1, q }, pos);
-				legalMoves.emplace_back<pieces::Pawn>(Move{ pawn, push1, r }, pos);
-				legalMoves.emplace_back<pieces::Pawn>(Move{ pawn, push1, b }, pos);
-				legalMoves.emplace_back<pieces::Pawn>(Move{ pawn, push1, n }, pos);
-			}
-			else {
-				legalMoves.emplace_back<pieces::Pawn>(Move{ pawn, push1 }, pos);
+		// Offsets from the square a Pawn moves to back to the square it moved from
+		constexpr int8_t back = -directions::DELTAS[Side::forward];
+		constexpr int8_t backLeft = -directions::DELTAS[Side::forwardLeft];
+		constexpr int8_t backRight = -directions::DELTAS[Side::forwardRight];
 
-				// === PUSH 2 ===
-				if (push2.isValid() && empty[push2]) {
-					legalMoves.emplace_back<pieces::Pawn>(Move{ pawn, push2 }, pos);
-				}
-			}
-		}
+		constexpr BitBoard promotionRank = 0xFFull << (8 * Side::promotionRow);
+		constexpr BitBoard doublePushRank = 0xFFull << (8 * Side::doublePushRow);
 
-		// === CAPTURE LEFT ===
-		if (captLeft.isValid() && theirs[captLeft]) {
-			if (captLeft.row() == promotionRow) {
-				legalMoves.emplace_back<pieces::Pawn>(Move{ pawn, captLeft, q }, pos);
-				legalMoves.emplace_back<pieces::Pawn>(Move{ pawn, captLeft, r }, pos);
-				legalMoves.emplace_back<pieces::Pawn>(Move{ pawn, captLeft, b }, pos);
-				legalMoves.emplace_back<pieces::Pawn>(Move{ pawn, captLeft, n }, pos);
-			}
-			else {
-				legalMoves.emplace_back<pieces::Pawn>(Move{ pawn, captLeft }, pos);
-			}
-		}
+		// --- Pushes ---
+		BitBoard push1 = pawns;
+		push1.shift(Side::forward);
+		push1 &= empty;
 
-		// === CAPTURE RIGHT ===
-		if (captRight.isValid() && theirs[captRight]) {
-			if (captRight.row() == promotionRow) {
-				legalMoves.emplace_back<pieces::Pawn>(Move{ pawn, captRight, q }, pos);
-				legalMoves.emplace_back<pieces::Pawn>(Move{ pawn, captRight, r }, pos);
-				legalMoves.emplace_back<pieces::Pawn>(Move{ pawn, captRight, b }, pos);
-				legalMoves.emplace_back<pieces::Pawn>(Move{ pawn, captRight, n }, pos);
-			}
-			else {
-				legalMoves.emplace_back<pieces::Pawn>(Move{ pawn, captRight }, pos);
-			}
-		}
+		// Only Pawns that pushed 1 square from their starting rank can push again
+		BitBoard push2 = push1;
+		push2.shift(Side::forward);
+		push2 &= empty & doublePushRank & allowed;
 
-		// TODO: ENPASSENT: Don't forget enpassent
-			}
-
-	// Generates moves of a ray piece in some direction.
-	// Iterates from 'ray' to edge of board or until an obstacle is hit.
-	// Generates capture and push moves
-	// 'ray' - Coordinate of ray piece of which moves are to be generated
-	// 'obstacles - BitBoard of allToFen pieces
-	// 'theirs' - BitBoard of allToFen pieces of opposite color to piece at 'ray'
-	// 'legals' - MoveList of legal moves
-	// 'pos' - Current position
-	template<typename RAY_DIRECTION_T, typename PIECE_T>
-	void genRayMoves(BoardSquare ray, BitBoard occupied, BitBoard theirs, MoveList& legals, const Position& pos)
-	{
-		static_assert(std::is_base_of<directions::Ray, RAY_DIRECTION_T>(),
-			"This function can only be called on a Ray direction");
+		push1 &= allowed;
 
-		BoardSquare it = ray;
+		// --- Captures ---
+		BitBoard captLeft = pawns;
+		captLeft.shift(Side::forwardLeft);
+		captLeft &= theirs & allowed;
 
-		while (RAY_DIRECTION_T::wouldBeInBounds(it)) {
-			it = RAY_DIRECTION_T::move(it);
+		BitBoard captRight = pawns;
+		captRight.shift(Side::forwardRight);
+		captRight &= theirs & allowed;
 
-			if (occupied[it]) {
-				// Cell is occupied either by one of our or their pieces
+		// --- Serialize ---
+		addPawnMoves<SIDE>(push1 & ~promotionRank, back);
+		addPawnMoves<SIDE>(push2, 2 * back);
+		addPawnMoves<SIDE>(captLeft & ~promotionRank, backLeft);
+		addPawnMoves<SIDE>(captRight & ~promotionRank, backRight);
 
-				if (theirs[it]) {
-					// Capture Piece
-					legals.emplace_back<PIECE_T>(Move{ ray, it }, pos);
-				}
+		addPawnPromotions<SIDE>(push1 & promotionRank, back);
+		addPawnPromotions<SIDE>(captLeft & promotionRank, backLeft);
+		addPawnPromotions<SIDE>(captRight & promotionRank, backRight);
 
-				// Break at every obstacle
-				break;
-			}
-			else {
-				// Cell is empty
-				legals.emplace_back<PIECE_T>(Move{ ray, it }, pos);
-			}
-		}
+		// TODO: ENPASSENT: Don't forget enpassent
 	}
 
 	void MoveGenerator2::genFreeRookMoves(BoardSquare rook)
@@ -761,25 +444,10 @@ namespace forge
 			cout << termcolor::push << termcolor::bright_red
 				<< "Error: " << __FILE__ << " line " << __LINE__
 				<< " " << rook << " is a " << b.at(rook) << " and not a rook" << endl;
-	}
+		}
 #endif // _DEBUG
 
-		genRayMoves<directions::Up, pieces::Rook>(rook, occupied, theirs, legalMoves, pos);
-		genRayMoves<directions::Down, pieces::Rook>(rook, occupied, theirs, legalMoves, pos);
-		genRayMoves<directions::Left, pieces::Rook>(rook, occupied, theirs, legalMoves, pos);
-		genRayMoves<directions::Right, pieces::Rook>(rook, occupied, theirs, legalMoves, pos);
-	}
-
-	template<typename KNIGHT_DIRECTION_T>
-	void genKnightMoves(BoardSquare knight, BitBoard ours, MoveList& legals, const Position& pos)
-	{
-		if (KNIGHT_DIRECTION_T::wouldBeInBounds(knight)) {
-			BoardSquare to = KNIGHT_DIRECTION_T::move(knight);
-
-			if (ours[to] == false) {
-				legals.emplace_back<pieces::Knight>(Move{ knight, to }, pos);
-			}
-		}
+		addMoves<pieces::Rook>(rook, MagicBitBoards::rookAttacks(rook, occupied) & ~ours);
 	}
 
 	void MoveGenerator2::genFreeKnightMoves(BoardSquare knight)
@@ -792,20 +460,10 @@ namespace forge
 			cout << termcolor::push << termcolor::bright_red
 				<< "Error: " << __FILE__ << " line " << __LINE__
 				<< " " << knight << " is a " << b.at(knight) << " and not a knight" << endl;
-	}
+		}
 #endif // _DEBUG
 
-		// TODO: OPTIMIZE: Bounds checking is redundant here.
-		// find a way to optimize bounds checking in this function.
-
-		genKnightMoves<directions::Knight0>(knight, ours, legalMoves, pos);
-		genKnightMoves<directions::Knight1>(knight, ours, legalMoves, pos);
-		genKnightMoves<directions::Knight2>(knight, ours, legalMoves, pos);
-		genKnightMoves<directions::Knight3>(knight, ours, legalMoves, pos);
-		genKnightMoves<directions::Knight4>(knight, ours, legalMoves, pos);
-		genKnightMoves<directions::Knight5>(knight, ours, legalMoves, pos);
-		genKnightMoves<directions::Knight6>(knight, ours, legalMoves, pos);
-		genKnightMoves<directions::Knight7>(knight, ours, legalMoves, pos);
+		addMoves<pieces::Knight>(knight, pieces::Knight::pushMask(knight) & ~ours);
 	}
 
 	void MoveGenerator2::genFreeBishopMoves(BoardSquare bishop)
@@ -818,14 +476,11 @@ namespace forge
 			cout << termcolor::push << termcolor::bright_red
 				<< "Error: " << __FILE__ << " line " << __LINE__
 				<< " " << bishop << " is a " << b.at(bishop) << " and not a bishop" << endl;
-	}
+		}
 #endif // _DEBUG
 
-		genRayMoves<directions::UL, pieces::Bishop>(bishop, occupied, theirs, legalMoves, pos);
-		genRayMoves<directions::UR, pieces::Bishop>(bishop, occupied, theirs, legalMoves, pos);
-		genRayMoves<directions::DL, pieces::Bishop>(bishop, occupied, theirs, legalMoves, pos);
-		genRayMoves<directions::DR, pieces::Bishop>(bishop, occupied, theirs, legalMoves, pos);
-		}
+		addMoves<pieces::Bishop>(bishop, MagicBitBoards::bishopAttacks(bishop, occupied) & ~ours);
+	}
 
 	void MoveGenerator2::genFreeQueenMoves(BoardSquare queen)
 	{
@@ -837,17 +492,14 @@ namespace forge
 			cout << termcolor::push << termcolor::bright_red
 				<< "Error: " << __FILE__ << " line " << __LINE__
 				<< " " << queen << " is a " << b.at(queen) << " and not a pawn" << endl;
-	}
+		}
 #endif // _DEBUG
 
-		genRayMoves<directions::Up, pieces::Queen>(queen, occupied, theirs, legalMoves, pos);
-		genRayMoves<directions::Down, pieces::Queen>(queen, occupied, theirs, legalMoves, pos);
-		genRayMoves<directions::Left, pieces::Queen>(queen, occupied, theirs, legalMoves, pos);
-		genRayMoves<directions::Right, pieces::Queen>(queen, occupied, theirs, legalMoves, pos);
-
-		genRayMoves<directions::UL, pieces::Queen>(queen, occupied, theirs, legalMoves, pos);
-		genRayMoves<directions::UR, pieces::Queen>(queen, occupied, theirs, legalMoves, pos);
-		genRayMoves<directions::DL, pieces::Queen>(queen, occupied, theirs, legalMoves, pos);
-		genRayMoves<directions::DR, pieces::Queen>(queen, occupied, theirs, legalMoves, pos);
+		addMoves<pieces::Queen>(queen, MagicBitBoards::queenAttacks(queen, occupied) & ~ours);
 	}
+
+	// --- Explicit Instantiations ---
+	// Needed by generate<SIDE>() and generateMoves<SIDE>() which are defined in the header.
+	template void MoveGenerator2::genLegalMoves<WHITE>(const Position& pos, Mode mode, Filter filter);
+	template void MoveGenerator2::genLegalMoves<BLACK>(const Position& pos, Mode mode, Filter filter);
 } // namespace forge
@@ -1,114 +1,241 @@
 #pragma once
 
 #include "forge/feature_extractor/Attackers.h"
-#include "forge/feature_extractor/KingAttackers.h"
-#include "forge/feature_extractor/Pin.h"
 #include "forge/feature_extractor/Threats.h"
 
 #include "forge/core/Position.h"
+#include "forge/core/MoveBatch.h"
 #include "forge/core/MoveList.h"
+#include "forge/core/MoveVector.h"
 
 #include <iostream>
 
 namespace forge
 {
+	// Returns true iff 'move' puts the King of the player who is not moving in check.
+	// Covers direct checks (including from a promoted piece) and discovered checks.
+	// Does not make the move.
+	// 'move' must be a legal move of 'pos'.
+	bool givesCheck(const Position & pos, Move move);
+
+	// Everything about move generation that depends on the color of the side to move.
+	// Known at compile time so that MoveGenerator2 never branches on color while generating.
+	template<color_t SIDE>
+	struct SideToMove;
+
+	template<>
+	struct SideToMove<WHITE>
+	{
+		using Pawn = pieces::WhitePawn;
+		using King = pieces::WhiteKing;
+
+		static const directions::direction_t forward = directions::UP;				// Direction our Pawns push
+		static const directions::direction_t forwardLeft = directions::UP_LEFT;		// Direction our Pawns capture to the left
+		static const directions::direction_t forwardRight = directions::UP_RIGHT;	// Direction our Pawns capture to the right
+
+		static const uint8_t startingRow = 6;	// Row our Pawns can push 2 squares from
+		static const uint8_t doublePushRow = 4;	// Row our Pawns land on after pushing 2 squares
+		static const uint8_t promotionRow = 0;	// Row our Pawns promote on
+
+		static const pieces::Piece::piece_t queen = pieces::Piece::WHITE_QUEEN;
+		static const pieces::Piece::piece_t rook = pieces::Piece::WHITE_ROOK;
+		static const pieces::Piece::piece_t bishop = pieces::Piece::WHITE_BISHOP;
+		static const pieces::Piece::piece_t knight = pieces::Piece::WHITE_KNIGHT;
+	};
+
+	template<>
+	struct SideToMove<BLACK>
+	{
+		using Pawn = pieces::BlackPawn;
+		using King = pieces::BlackKing;
+
+		static const directions::direction_t forward = directions::DOWN;
+		static const directions::direction_t forwardLeft = directions::DOWN_LEFT;
+		static const directions::direction_t forwardRight = directions::DOWN_RIGHT;
+
+		static const uint8_t startingRow = 1;
+		static const uint8_t doublePushRow = 3;
+		static const uint8_t promotionRow = 7;
+
+		static const pieces::Piece::piece_t queen = pieces::Piece::BLACK_QUEEN;
+		static const pieces::Piece::piece_t rook = pieces::Piece::BLACK_ROOK;
+		static const pieces::Piece::piece_t bishop = pieces::Piece::BLACK_BISHOP;
+		static const pieces::Piece::piece_t knight = pieces::Piece::BLACK_KNIGHT;
+	};
+
 	class MoveGenerator2
 	{
+	public:
+		friend class StagedMoveGenerator;
+
 	private:
 		// Clears fields
 		// Should be called once before every move generation.
+		// Containers are cleared, not replaced, so their capacity is reused.
 		void reset();
 
 		// Evaluates most fields that will be used in later methods.
 		// Should be called onces in generate(), right after reset().
+		template<color_t SIDE>
 		void preprocess(const Position & pos);
 
 	public:
 
+		// Generates every legal move of 'pos' along with the Position each move leads to.
 		MoveList & generate(const Position & pos);
 
+		// Same as generate() but the side to move is known at compile time.
+		// 'SIDE' must be the side to move of 'pos'.
+		template<color_t SIDE>
+		MoveList & generate(const Position & pos);
+
+		// Generates every legal move of 'pos' without the Positions they lead to.
+		// Much faster than generate() because 'pos' is never copied. 
+		// Apply a move yourself with Position::move<>() only when it is needed.
+		MoveVector & generateMoves(const Position & pos);
+
+		// Same as generateMoves() but the side to move is known at compile time.
+		// 'SIDE' must be the side to move of 'pos'.
+		template<color_t SIDE>
+		MoveVector & generateMoves(const Position & pos);
+
+		// Generates the legal moves of 'count' Positions starting at 'positions' into 'batch'.
+		// Same moves as generateMoves() on each Position, stored back to back. See MoveBatch.
+		// Nothing is allocated per Position. 'batch' is cleared first and only grows when
+		// it has never held that many moves before.
+		void generateBatch(const Position * positions, size_t count, MoveBatch & batch);
+
+		// Generates only captures and promotions (including quiet promotions) of 'pos'.
+		// When our King is in check, generates every evasion instead, captures or not,
+		// because a quiescence search can't stand pat while in check.
+		// Moves are generated the same way as generateMoves().
+		MoveVector & generateCaptures(const Position & pos);
+
+		// Generates only the moves of 'pos' that put their King in check.
+		// Includes direct checks, discovered checks and promotions that give check.
+		// Each piece only keeps the destinations that check their King directly, which is exact.
+		// Only pieces that can give a discovered check ('discoverers') and promotions are
+		// tested move by move with givesCheck().
+		// Moves are generated the same way as generateMoves().
+		MoveVector & generateChecks(const Position & pos);
+
+		// Returns the number of legal moves of 'pos' without generating them.
+		// Moves of each piece are counted in bulk by popcounting their destination squares.
+		size_t count(const Position & pos);
+
+		// Returns true iff 'pos' has at least one legal move.
+		// Stops at the first legal move found, looking at the cheapest pieces first
+		// (King, Knights, Pawns, then Rays). Use it to test for checkmate and stalemate.
+		bool hasLegalMove(const Position & pos);
+
 		const BitBoard & getThreats() const { return threats; }
 
 	private:
+		// What gets generated.
+		enum class Mode : uint8_t {
+			MOVE_POSITION_PAIRS,	// Moves and resulting Positions into 'legalMoves'
+			MOVES_ONLY,				// Moves only into 'legalMoveVector'
+			COUNT,					// Number of moves only into 'nLegalMoves'
+			ANY,					// Only whether a move exists. 'nLegalMoves' is non-zero once one is found
+		};
+
+		// Which legal moves get generated.
+		enum class Filter : uint8_t {
+			ALL,						// Every legal move
+			CAPTURES_AND_PROMOTIONS,	// Only captures and promotions (including quiet promotions)
+			QUIETS,						// Only non-capturing, non-promoting moves
+			QUIESCENCE,					// CAPTURES_AND_PROMOTIONS, or ALL when our King is in check
+			CHECKS,						// Only moves that give check. See givesCheck()
+		};
+
+		// Generates legal moves of 'pos' into the container selected by 'mode'.
+		// Only moves accepted by 'filter' are kept.
+		// Dispatches once on the side to move. Everything after that is compiled for one color.
+		void genLegalMoves(const Position & pos, Mode mode, Filter filter = Filter::ALL);
+
+		// 'SIDE' must be the side to move of 'pos'.
+		template<color_t SIDE>
+		void genLegalMoves(const Position & pos, Mode mode, Filter filter = Filter::ALL);
+
+		// Every generated move goes through one of these methods.
+		// PIECE_T - Piece type to be moved. Used to apply the move in MOVE_POSITION_PAIRS mode.
+
+		// Adds a single move.
+		template<typename PIECE_T>
+		void addMove(Move move);
+
+		// Adds 1 move from 'piece' to each square of 'moveMask'.
+		template<typename PIECE_T>
+		void addMoves(BoardSquare piece, BitBoard moveMask);
+
+		// Adds 1 Pawn move to each square of 'destinations'.
+		// Each move starts 'fromOffset' squares away from its destination.
+		// Used for set-wise Pawn generation where every Pawn moves in the same direction at once.
+		template<color_t SIDE>
+		void addPawnMoves(BitBoard destinations, int8_t fromOffset);
+
+		// Same as addPawnMoves() but adds all 4 promotions for each square of 'destinations'.
+		template<color_t SIDE>
+		void addPawnPromotions(BitBoard destinations, int8_t fromOffset);
+
 	public:	// <-- Only for testing
 
-		// Searches for Pins and generates legal moves for those pieces but
-		// only if 'searchOnly' is set to false.
-		// If 'searchOnly' is set to true, then Pins are searched and recorded without 
-		// any moves being generated.
-		// When King is attacked exacly once, 'searchOnly' should be true.
-		// Otherwise 'searchOnly' should be false.
-		void genPinMoves(const Board & b, bool isWhitesTurn, bool searchOnly);
-		
-		// Make sure to only call on valid Pin objects.  
-		// Generated Positions will be push to this->legalMoves
-		// If 'searchOnly' is set to true, then Pins are searched and recorded without 
-		// any moves being generated.
-		template<typename RAY_DIRECTION_T>
-		void genPinMovesFor(Pin pin, bool searchOnly);
-
-		// Used for forward checking to efficiently verify that a pin is possible before performing
-		// expensive pin search calculations. 
-		// This method only tells us if a pin is possible or definitely impossible. 
-		// It does not tell us if a pin definitely exists.
-		// RAY_DIRECTION_T - is the a ray direction that a pin is to be verified from. 
-		//	See namespace forge::directions.
-		// theirRays - Squares containing their ray pieces that can attack in direction of RAY_DIRECTION_T.
-		//		ex: Rooks and Queens can attack Up, Down, Left and Right
-		// ourBlockers - Squares of allToFen our pieces that can block our King. In otherwords, allToFen our pieces
-		//		except our King.
-		template<typename DIRECTION_T>
-		bool isPinPossible() const;
-
-		// Searches in some direction for our pieces that are pinned to our King. 
-		// theirRays - ray pieces that can attack in given directions. 
-		//		ex: If RAY_DIRECTION_T is Up, then theirRays should equals thier queens and rooks.
-		// Performs efficient forward checking to identify if a pin is possible before
-		//	performing further expensive search.
-		// Returns:
-		//		first - coordinate of pinned
-		//		second - coordinate of pinner
-		template<typename RAY_DIRECTION_T>
-		Pin pinSearch() const;
-
-		// Searches in some direction for a piece that might qualify as a pinned to its king.
-		// If a candidite piece is found, then its coordinates are returned.
-		// If a piece is not found, then an invalid BoardSquare is returned.
-		// * See comments of pinSearch()
-		template<typename RAY_DIRECTION_T>
-		BoardSquare findPinned() const;
-
-		// Searches in some direction for a piece that might qualify as a pinner to a king.
-		// pinnedPiece - coordinate of a candidate piece that could be pinned to king.
-		// If a pinner is found, then its coordinates are returned.
-		// If a pinner is not found, then an invalid BoardSquare is returend.
-		// * See comments of pinSearch()
-		template<typename RAY_DIRECTION_T>
-		BoardSquare findPinner(BoardSquare pinnedPiece) const;
-
-		// Given a direction and nothing else, this method will search for absolute pins and generate
-		// legal moves for the pinned piece.  Moves are added to legalMoves.
-		// When 'searchOnly' is true, pins are only searched and their moves are not generated.
-		template<typename DIRECTION_T>
-		void searchAndGeneratePins(bool searchOnly);
+		// Finds, in a single pass, which of their pieces attack our King ('checkers') and
+		// which of our pieces are pinned to our King ('ourAbsolutePins').
+		// Pins are found with x-rays: Their Rays lined up with our King that have exactly 
+		// one of our pieces between them and our King.
+		// Called from preprocess().
+		template<color_t SIDE>
+		void findPinsAndCheckers();
+
+		// Finds our pieces that stand alone between one of our Rays and their King ('discoverers').
+		// Moving one of them may give a discovered check.
+		// Same x-ray as the pins of findPinsAndCheckers() but from their King.
+		// Only needed for Filter::CHECKS.
+		void findDiscoverers();
+
+		// Squares a PIECE_T standing on 'from' could move to and check their King directly.
+		template<typename PIECE_T>
+		BitBoard directCheckSquares(BoardSquare from) const;
+
+		// Returns true iff 'move' of a PIECE_T puts their King in check.
+		// Only promotions and moves of 'discoverers' need the full forge::givesCheck().
+		// Every other move checks iff it lands on directCheckSquares().
+		template<typename PIECE_T>
+		bool givesCheck(Move move) const;
+
+		// Squares a pinned piece can move to without exposing our King.
+		// The whole line through our King and 'pinned'. The King and the pinner 
+		// bound it so any attack of 'pinned' masked with it is a legal move.
+		BitBoard pinRay(BoardSquare pinned) const { return tables::line[ourKing.val()][pinned.val()]; }
+
+		// Generates the legal moves of our pinned pieces.
+		// Only call when our King is not in check. Pinned pieces can never get our King out of check.
+		template<color_t SIDE>
+		void genPinMoves();
 
 		// Generates King caputres and pushes.
+		template<color_t SIDE>
 		void genKingMoves();
 
-		// Generates moves that block attackers from attacking the King
-		// and moves that capture pieces that attack the King.
-		// Should not be called with searchAndGeneratePins() otherwise some
-		// moves will be generated twice.
-		void genBlockAndCaptureMoves(const KingAttacker & attacker);
+		template<color_t SIDE>
+		void genFreeMoves();
 
-		void genPawnBlockAndCapture(const KingAttacker& attacker, BitBoard captureMask);
-		void genLateralBlockAndCaptureRay(const KingAttacker& attacker, BitBoard captureMask);
-		void genDiagonalBlockAndCaptureRay(const KingAttacker& attacker, BitBoard captureMask);
-		void genKnightBlockAndCaptureRay(const KingAttacker& attacker, BitBoard captureMask);
+		// Same as genFreeMoves() but stops at the first legal move found.
+		// Pieces are visited from cheapest to most expensive to generate. 
+		// Only used in ANY mode.
+		template<color_t SIDE>
+		void genAnyFreeMove();
 
-		void genFreeMoves();
+		// Generates the moves of every unpinned Pawn at once.
+		// Each kind of move (push, double push, left and right capture) is found for all Pawns
+		// with a single shift of the Pawn BitBoard.
+		template<color_t SIDE>
+		void genFreePawnMoves();
 
-		void genFreePawnMoves(BoardSquare pawn);
+		// Generates the moves of 'pawns' that land on 'allowed'.
+		template<color_t SIDE>
+		void genPawnMoves(BitBoard pawns, BitBoard allowed);
 		void genFreeRookMoves(BoardSquare rook);
 		void genFreeKnightMoves(BoardSquare knight);
 		void genFreeBishopMoves(BoardSquare bishop);
@@ -135,14 +262,10 @@ namespace forge
 		// Their Rays 
 		BitBoard theirRays;
 
-		// Our Diagonal Rays (Queens and Bishops)
-		BitBoard ourDiagonals;
-		// Their Diagonal Rays
+		// Their Diagonal Rays (Queens and Bishops)
 		BitBoard theirDiagonals;
 
-		// Our Lateral Rays (Queens and Rooks)
-		BitBoard ourLaterals;
-		// Their Lateral Rays
+		// Their Lateral Rays (Queens and Rooks)
 		BitBoard theirLaterals;
 
 		// The squares that their pieces are attacking.
@@ -155,14 +278,40 @@ namespace forge
 		BitBoard theirBlockers;
 
 		// The squares of our pinned pieces that are pinned to our King
-		// This BitBoard will be set from genPinMoves()
-		// After calling genPinMoves(), the moves of these pieces will have been added to the MoveList
+		// This BitBoard will be set from findPinsAndCheckers()
 		BitBoard ourAbsolutePins;
 
+		// Our pieces that may give a discovered check when they move
+		// This BitBoard will be set from findDiscoverers() (Filter::CHECKS only)
+		BitBoard discoverers;
+
+		// The squares of their pieces that are attacking our King
+		// This BitBoard will be set from findPinsAndCheckers()
+		BitBoard checkers;
+
+		// Squares non-King moves must land on to get our King out of check.
+		// All ones when our King is not in check.
+		BitBoard checkMask;
+
 		const Position * currPositionPtr = nullptr;
+
+		Mode mode = Mode::MOVE_POSITION_PAIRS;
+
+		Filter filter = Filter::ALL;
+
+		// Squares generated moves may land on. Set from 'filter'.
+		// Promotions are handled separately. See addMove().
+		BitBoard targets;
 		
-		// List of legal moves
+		// List of legal moves (MOVE_POSITION_PAIRS mode)
 		MoveList legalMoves;
+
+		// List of legal moves (MOVES_ONLY mode)
+		MoveVector legalMoveVector;
+
+		// Number of legal moves (COUNT mode)
+		// Non-zero once a legal move is found (ANY mode)
+		size_t nLegalMoves = 0;
 	};
 } // namespace forge
 
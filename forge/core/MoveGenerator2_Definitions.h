@@ -1,259 +1,175 @@
 #pragma once
 
 #include "forge/core/MoveGenerator2.h"
+#include "forge/core/MagicBitBoards.h"
+
+#include <type_traits>
 
 namespace forge
 {
-	template<typename RAY_DIRECTION_T>
-	void MoveGenerator2::genPinMovesFor(Pin pin, bool searchOnly)
+	template<color_t SIDE>
+	MoveList & MoveGenerator2::generate(const Position & pos)
 	{
-		const Board & b = currPositionPtr->board();
-		const pieces::Piece piece = b.at(pin.pinned);
-
-		///cout << piece << " is pinned. " << piece.val() << "\n";
-		
-		// 0.) --- Make sure direction is a Ray
-		static_assert(std::is_base_of<directions::Ray, RAY_DIRECTION_T>(),
-			"RAY_DIRECTION_T must be a ray direction");
+		genLegalMoves<SIDE>(pos, Mode::MOVE_POSITION_PAIRS);
 
-		// 1.) --- Mark the pinned piece ---
-		// Mark as an absolut pin so that later we don't generate free moves for this piece.
-		ourAbsolutePins[pin.pinned] = 1;
+		return legalMoves;
+	}
 
-		// Generate legal moves for pins, but only if 'searchOnly' is set to false
-		if (searchOnly == false) {
-			// 2.) --- Mark the bits between the King (exclusive) and Attacker (inclusive) ---
-			BitBoard battleGround = BitBoard::mask<RAY_DIRECTION_T>(ourKing, pin.pinner);
-			battleGround[ourKing] = 0;		// Exclude King
-			battleGround[pin.pinner] = 1;	// Include pinner
+	template<color_t SIDE>
+	MoveVector & MoveGenerator2::generateMoves(const Position & pos)
+	{
+		genLegalMoves<SIDE>(pos, Mode::MOVES_ONLY);
 
-			// 3.) --- Calculate Push and Capture Masks ---
-			// Squares pinned piece can push to (same for non-Pawns)
-			// Squares pinned piece can capture on (same for non-Pawns)
-			BitBoard pushMask;			// Squares pinned piece can push to 
-			BitBoard captureMask;		// Squares pinned piece can capture on
-			piece.masks(pin.pinned, pushMask, captureMask);
+		return legalMoveVector;
+	}
 
-			// 4.) --- Overlap masks with battleGround and their pieces ---
-			pushMask &= battleGround & (~theirs);		// Should contain 1s where pinned can push to between King and pinner
-			captureMask &= battleGround & (theirs);		// Should contain a 1 on pinner or allToFen zeros
+	template<typename PIECE_T>
+	void MoveGenerator2::addMove(Move move)
+	{
+		// --- Apply filter ---
+		// Promotions count as captures even when they don't capture anything.
+		// They still have to get our King out of check.
+		if (move.isPromotion()) {
+			if (filter == Filter::QUIETS || checkMask[move.to()] == false) return;
+		}
+		else if (targets[move.to()] == false) {
+			return;
+		}
 
-			// 5.) --- Actually generate some moves already ---
-			// --- Look ahead: Are any push moves possible? ---
-			if (pushMask.any()) {
-				// Yes a push move is possible
+		if (filter == Filter::CHECKS && givesCheck<PIECE_T>(move) == false) return;
+
+		switch (mode) {
+		case Mode::MOVE_POSITION_PAIRS:
+			legalMoves.emplace_back<PIECE_T>(move, *currPositionPtr);
+			break;
+		case Mode::MOVES_ONLY:
+			legalMoveVector.push_back(move);
+			break;
+		case Mode::COUNT:
+		case Mode::ANY:
+			nLegalMoves++;
+			break;
+		}
+	}
 
-				// What piece is moving?
-				if (piece.isPawn()) {
-					if (piece.isWhite())
-						legalMoves.emplace_back<pieces::WhitePawn, RAY_DIRECTION_T>(ourKing, pin.pinned, pin.pinner, pushMask, *currPositionPtr);
-					else
-						legalMoves.emplace_back<pieces::BlackPawn, RAY_DIRECTION_T>(ourKing, pin.pinned, pin.pinner, pushMask, *currPositionPtr);
+	template<typename PIECE_T>
+	void MoveGenerator2::addMoves(BoardSquare piece, BitBoard moveMask)
+	{
+		// Never used for Pawns moving to their last rank, so there are no promotions here.
+		moveMask &= targets;
+
+		if (filter == Filter::CHECKS) {
+			// Moving this piece might discover a check. Check every move individually.
+			if (discoverers[piece]) {
+				for (BoardSquare to : moveMask) {
+					addMove<PIECE_T>(Move{ piece, to });
 				}
-				if (piece.isQueen())
-					legalMoves.emplace_back<pieces::Queen, RAY_DIRECTION_T>(ourKing, pin.pinned, pin.pinner, pushMask, *currPositionPtr);
-				if (piece.isBishop())
-					legalMoves.emplace_back<pieces::Bishop, RAY_DIRECTION_T>(ourKing, pin.pinned, pin.pinner, pushMask, *currPositionPtr);
-				if (piece.isKnight())
-					legalMoves.emplace_back<pieces::Knight, RAY_DIRECTION_T>(ourKing, pin.pinned, pin.pinner, pushMask, *currPositionPtr);
-				if (piece.isRook())
-					legalMoves.emplace_back<pieces::Rook, RAY_DIRECTION_T>(ourKing, pin.pinned, pin.pinner, pushMask, *currPositionPtr);
-				// No need to do King because, Kings are never pinned.
+				return;
 			}
 
-			// --- Look ahead: Are any capture moves possible? ---
-			if (captureMask.any()) {
-				// Yes a capture move is possible
-
-				// What piece is moving?
-				if (piece.isPawn()) {
-					// TODO: Pawns can be promoted even when pinned when they capture their pinner.
-					// TODO: Enpassent: Pinned pawns sometimes cannot do enpassent.
+			// Otherwise every move to one of these squares gives check and no other move does
+			moveMask &= directCheckSquares<PIECE_T>(piece);
+		}
 
-					if (piece.isWhite()) {
-						if (pin.pinner.isTopRank()) {
-							// Capture will occur on promotion rank
-							legalMoves.emplace_back<pieces::WhitePawn>(Move{ pin.pinned, pin.pinner, pieces::whiteQueen }, *currPositionPtr);
-							legalMoves.emplace_back<pieces::WhitePawn>(Move{ pin.pinned, pin.pinner, pieces::whiteRook }, *currPositionPtr);
-							legalMoves.emplace_back<pieces::WhitePawn>(Move{ pin.pinned, pin.pinner, pieces::whiteBishop }, *currPositionPtr);
-							legalMoves.emplace_back<pieces::WhitePawn>(Move{ pin.pinned, pin.pinner, pieces::whiteKnight }, *currPositionPtr);
-						}
-						else {
-							// Capture will not occur on promotion rank
-							legalMoves.emplace_back<pieces::WhitePawn>(Move{ pin.pinned, pin.pinner }, *currPositionPtr);
-						}
-					}
-					else {
-						if (pin.pinner.isBotRank()) {
-							// Capture will occur on promotion rank
-							legalMoves.emplace_back<pieces::BlackPawn>(Move{ pin.pinned, pin.pinner, pieces::blackQueen }, *currPositionPtr);
-							legalMoves.emplace_back<pieces::BlackPawn>(Move{ pin.pinned, pin.pinner, pieces::blackRook }, *currPositionPtr);
-							legalMoves.emplace_back<pieces::BlackPawn>(Move{ pin.pinned, pin.pinner, pieces::blackBishop }, *currPositionPtr);
-							legalMoves.emplace_back<pieces::BlackPawn>(Move{ pin.pinned, pin.pinner, pieces::blackKnight }, *currPositionPtr);
-						}
-						else {
-							// Capture will not occur on promotion rank
-							legalMoves.emplace_back<pieces::BlackPawn>(Move{ pin.pinned, pin.pinner }, *currPositionPtr);
-						}
-					}
-				}
-				if (piece.isQueen())
-					legalMoves.emplace_back<pieces::Queen>(Move{ pin.pinned, pin.pinner }, *currPositionPtr);
-				if (piece.isBishop())
-					legalMoves.emplace_back<pieces::Bishop>(Move{ pin.pinned, pin.pinner }, *currPositionPtr);
-				if (piece.isKnight())
-					legalMoves.emplace_back<pieces::Knight>(Move{ pin.pinned, pin.pinner }, *currPositionPtr);
-				if (piece.isRook())
-					legalMoves.emplace_back<pieces::Rook>(Move{ pin.pinned, pin.pinner }, *currPositionPtr);
-				// No need to do King because, Kings are never pinned.
+		switch (mode) {
+		case Mode::MOVE_POSITION_PAIRS:
+			legalMoves.emplace_back<PIECE_T>(piece, moveMask, *currPositionPtr);
+			break;
+		case Mode::MOVES_ONLY:
+			for (BoardSquare to : moveMask) {
+				legalMoveVector.emplace_back(piece, to);
 			}
+			break;
+		case Mode::COUNT:
+			nLegalMoves += moveMask.count();
+			break;
+		case Mode::ANY:
+			nLegalMoves += moveMask.any();
+			break;
 		}
 	}
 
-	template<typename DIRECTION_T>
-	bool MoveGenerator2::isPinPossible() const
-	{
-		static_assert(
-			std::is_base_of<directions::Linear, DIRECTION_T>(),
-			"DIRECTION_T must be a Linear direction.");
-
-		// What squares would an opponent ray pieces have to be 
-		// standing on if a pin was to be possible.
-		BitBoard extents = BitBoard::mask<DIRECTION_T>(ourKing);
-
-		// For a pin to be possible (but non necessarily definite):
-		//	- atleast one of their ray pieces needs to be standing on extents, and
-		//	- atleast one of our blockers needs to be somewhere on extents also.
-		// Hints for optimizations: 
-		//	- if DIRECTION_T is a multi directional direction, (ex: Diagonal, Lateral), 
-		//		it is better to set ourBlockers to allToFen ones so that only theirRays are account. 
-		//		Our blockers might be in one direction (ex: Right) from the King while
-		//		one of their theirRays might be in another direction (ex: Up).
-		//		In this case a pin is not possible.
-		//		Because of this it is better to set ourBlockers to allToFen ones
-		//	- if DIRECTION_T is a ray direction, then its best to have ourBlockers be allToFen
-		//		our non-King pieces as it is less common for our pieces to be on the same 
-		//		ray as their ray pieces. When they are, a pin is possible.
-
-		// Does extents contain any of their rays? 
-		BitBoard overlap = extents & theirs & currPositionPtr->board().directionals<DIRECTION_T>();
-
-		// Does extents contain any of our blockers?
-		BitBoard possiblePins = extents & ourBlockers;
-
-		// If we have atleast one ray attacker and atleast one blocker, then a pin is possible.
-		return overlap.any() && possiblePins.any();
-	}
-
-	template<typename RAY_DIRECTION_T>
-	Pin MoveGenerator2::pinSearch() const
+	template<color_t SIDE>
+	void MoveGenerator2::addPawnMoves(BitBoard destinations, int8_t fromOffset)
 	{
-		// Make sure direction is a Ray Direction
-		static_assert(
-			std::is_base_of<directions::Ray, RAY_DIRECTION_T>(),
-			"RAY_DIRECTION_T must be a Ray direction.");
+		using OurPawn = typename SideToMove<SIDE>::Pawn;
 
-		// Coordinates of pinned and pinner pieces
-		Pin pin;
+		// Count in bulk. Nothing about a move needs to be known but its destination.
+		if ((mode == Mode::COUNT || mode == Mode::ANY) && filter != Filter::CHECKS) {
+			destinations &= targets;
+			nLegalMoves += (mode == Mode::COUNT ? destinations.count() : destinations.any());
+			return;
+		}
 
-		// Is it possible for a pin to occur in this direction?
-		if (isPinPossible<RAY_DIRECTION_T>()) {
-			pin.pinned = findPinned<RAY_DIRECTION_T>();
+		if (filter == Filter::CHECKS) {
+			// Only direct checks and moves of Pawns that may discover a check
+			BitBoard discovererDestinations = discoverers;
+			if (fromOffset > 0)	discovererDestinations >>= fromOffset;
+			else				discovererDestinations <<= -fromOffset;
 
-			// Did we find a candidate for a pinned piece?
-			if (pin.pinned.isValid()) {
-				// Yes, now lets see if one of their pieces are pinning it to our King.
-				pin.pinner = findPinner<RAY_DIRECTION_T>(pin.pinned);
-			}
+			destinations &= directCheckSquares<OurPawn>(BoardSquare{}) | discovererDestinations;
 		}
 
-		return pin;
+		for (BoardSquare to : destinations) {
+			addMove<OurPawn>(Move{ BoardSquare{ uint8_t(to.val() + fromOffset) }, to });
+		}
 	}
 
-	template<typename RAY_DIRECTION_T>
-	BoardSquare MoveGenerator2::findPinned() const
+	template<typename PIECE_T>
+	BitBoard MoveGenerator2::directCheckSquares(BoardSquare from) const
 	{
-		BoardSquare pinnedPiece = BoardSquare::invalid();
-		BoardSquare bs = ourKing;
-
-		// 1.) --- Find pinned piece (blocker) ---
-		while (RAY_DIRECTION_T::wouldBeInBounds(bs)) {
-
-			bs = RAY_DIRECTION_T::move(bs); // Called first to skip the King
-
-			// Whats on this square?
-			if (theirs[bs]) {
-				// This square contains one of their pieces.
-				// Meaning a pin does not exist in this direction. 
-				// It might be a check instead.
-				pinnedPiece.setAsInvalid();
+		// Sliders see through the square they leave
+		const BitBoard occupiedAfter = occupied & ~BitBoard::square(from);
 
-				break;
-			}
-			else if (ourBlockers[bs]) {
-				// This square contain one of our blockers.
-				// It might be the pinned piece we're looking for.
-				pinnedPiece = bs;
-				pinnedPiece.setAsValid();
-
-				// We still need to see if this piece has an attacker.
-				break;
-			}
+		// A piece checks their King from the squares the same piece standing on their King would attack.
+		// Pawns are the exception: ours attack in the opposite direction of theirs.
+		if constexpr (std::is_base_of<pieces::Knight, PIECE_T>()) {
+			return tables::knights[theirKing.val()];
+		}
+		else if constexpr (std::is_base_of<pieces::Bishop, PIECE_T>()) {
+			return MagicBitBoards::bishopAttacks(theirKing, occupiedAfter);
+		}
+		else if constexpr (std::is_base_of<pieces::Rook, PIECE_T>()) {
+			return MagicBitBoards::rookAttacks(theirKing, occupiedAfter);
+		}
+		else if constexpr (std::is_base_of<pieces::Queen, PIECE_T>()) {
+			return MagicBitBoards::queenAttacks(theirKing, occupiedAfter);
+		}
+		else if constexpr (std::is_same<pieces::WhitePawn, PIECE_T>()) {
+			return pieces::BlackPawn::captureMask(theirKing);
+		}
+		else if constexpr (std::is_same<pieces::BlackPawn, PIECE_T>()) {
+			return pieces::WhitePawn::captureMask(theirKing);
+		}
+		else {
+			// Kings never check directly
+			return BitBoard{};
 		}
-
-		return pinnedPiece;
 	}
 
-	template<typename RAY_DIRECTION_T>
-	BoardSquare MoveGenerator2::findPinner(BoardSquare pinnedPiece) const
+	template<typename PIECE_T>
+	bool MoveGenerator2::givesCheck(Move move) const
 	{
-		BoardSquare bs = pinnedPiece;
-		BitBoard possiblePinners = currPositionPtr->board().directionals<RAY_DIRECTION_T>() & theirs;
-
-		// 2.) --- Find pinner piece (attacker) ---
-		while (RAY_DIRECTION_T::wouldBeInBounds(bs)) {
-			bs = RAY_DIRECTION_T::move(bs);	// Called first to move from the pinnedPiece
-
-			// Whats on this square?
-			if (possiblePinners[bs]) {
-				// Yay. Pinner is found.
-				// This square contains one of their ray pieces that can attack 
-				// in the direction of the King.
-				break;
-			}
-			else if (theirs[bs]) {
-				// This square contains one of their other pieces.
-				// A pin is not possible in this direction.
-				bs.setAsInvalid();
-				break;
-			}
-			else if (ourBlockers[bs]) {
-				// This square contains one of our blockers.
-				// A pin is not possible in this direction.
-				bs.setAsInvalid();
-				break;
-			}
+		if (move.isPromotion() || discoverers[move.from()]) {
+			return forge::givesCheck(*currPositionPtr, move);
 		}
 
-		return bs;
+		return directCheckSquares<PIECE_T>(move.from())[move.to()];
 	}
 
-	template<typename DIRECTION_T>
-	void MoveGenerator2::searchAndGeneratePins(bool searchOnly)
+	template<color_t SIDE>
+	void MoveGenerator2::addPawnPromotions(BitBoard destinations, int8_t fromOffset)
 	{
-		// Find the pinned and pinner pieces for the absolute pin
-		Pin pin = pinSearch<DIRECTION_T>();
+		using Side = SideToMove<SIDE>;
+		using OurPawn = typename Side::Pawn;
 
-		//if (!pin.isValid()) {
-		//	cout << "No pin found in " << DIRECTION_T::str() << " direction." << endl;
-		//}
-		//else {
-		//	cout << pin.pinner << (pin.pinned.isValid() ? " valid" : " invalid") << " is pinning "
-		//		<< pin.pinned << (pin.pinned.isValid() ? " valid" : " invalid") << " to King "
-		//		<< "from " << DIRECTION_T::str() << " direction." << endl;
-		//}
+		for (BoardSquare to : destinations) {
+			BoardSquare from{ uint8_t(to.val() + fromOffset) };
 
-		// If a valid absolute pin was found, generate its legal moves
-		if (pin.isValid()) { genPinMovesFor<DIRECTION_T>(pin, searchOnly); }
+			addMove<OurPawn>(Move{ from, to, Side::queen });
+			addMove<OurPawn>(Move{ from, to, Side::rook });
+			addMove<OurPawn>(Move{ from, to, Side::bishop });
+			addMove<OurPawn>(Move{ from, to, Side::knight });
+		}
 	}
 } // namespace forge
\ No newline at end of file
@@ -21,13 +21,19 @@ namespace forge
 
 	// TODO: consider inheriting with protected instead of public to prevent 
 	//		users from calling push_back and emplace back
+	// Stored on the heap, unlike MoveVector. A full list of MovePositionPairs is about 40 KB,
+	// too big to put in every MoveGenerator2 or stack frame. Reuse a MoveList (clear() it)
+	// so that it only allocates the first time it grows.
 	class MoveList : public std::vector<MovePositionPair>
 	{
+	private:
+		using super = std::vector<MovePositionPair>;
+
 	public:
 		MoveList() = default;
 		MoveList(const MoveList &) = default;
 		MoveList(MoveList &&) noexcept = default;
-		virtual ~MoveList() noexcept = default;
+		~MoveList() noexcept = default;
 		MoveList & operator=(const MoveList &) = default;
 		MoveList & operator=(MoveList &&) noexcept = default;
 
@@ -50,6 +56,14 @@ namespace forge
 		template<typename PIECE_T, typename RAY_DIRECTION_T>
 		void emplace_back(BoardSquare begin, BoardSquare piece, BoardSquare end, BitBoard moveMask, const Position & currPos);
 
+		// Appends 1 MovePositionPair for every 1 in moveMask.
+		// PIECE_T - Piece type to be moved.
+		// piece - Coordinate of piece that is moving
+		// moveMask - BitBoard containing 1s where ever the piece may move to (push/captures).
+		// currPos - current state of game.
+		template<typename PIECE_T>
+		void emplace_back(BoardSquare piece, BitBoard moveMask, const Position & currPos);
+
 		void print(std::ostream & os = std::cout) const;
 
 		MoveList::const_iterator find(Move move) const;
@@ -62,8 +76,7 @@ namespace forge
 	{
 		// 1.) --- Copy move and position to back of container ---
 		// Specify base class to prevent infinite recursion
-		std::vector<MovePositionPair>::emplace_back(move, currPos);
-		MovePositionPair & pair = this->std::vector<MovePositionPair>::back();
+		MovePositionPair & pair = super::emplace_back(move, currPos);
 
 		// 2.) --- Apply move to the pushed position ---
 		pair.position.move<PIECE_T>(move);
@@ -100,4 +113,15 @@ namespace forge
 		}
 	}
 
+	template<typename PIECE_T>
+	void MoveList::emplace_back(
+		BoardSquare piece,
+		BitBoard moveMask,
+		const Position & currPos)
+	{
+		for (BoardSquare to : moveMask) {
+			this->emplace_back<PIECE_T>(Move{ piece, to }, currPos);
+		}
+	}
+
 } // namespace forge
\ No newline at end of file
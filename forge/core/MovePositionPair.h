@@ -33,4 +33,7 @@ namespace forge
 		Move move;
 		Position position;
 	};
+
+	static_assert(std::is_trivially_copyable<MovePositionPair>(),
+		"MovePositionPair must be trivially copyable");
 } // namespace forge
\ No newline at end of file
@@ -0,0 +1,22 @@
+#include "forge/core/MoveVector.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace forge
+{
+	void MoveVector::print(std::ostream & os) const
+	{
+		for (const Move & move : *this) {
+			os << move << ' ';
+		}
+
+		os << '\n';
+	}
+
+	MoveVector::const_iterator MoveVector::find(Move move) const
+	{
+		return std::find(this->begin(), this->end(), move);
+	}
+} // namespace forge
\ No newline at end of file
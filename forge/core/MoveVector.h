@@ -0,0 +1,32 @@
+#pragma once
+
+#include "forge/core/Move.h"
+#include "forge/core/FixedVector.h"
+
+#include <iostream>
+
+namespace forge
+{
+	// Most legal moves a Position can have. The record is 218, rounded up.
+	const size_t MAX_MOVES = 256;
+
+	// Compact list of Moves.
+	// Unlike MoveList, only Moves are stored. The Position that results from each 
+	// Move is not computed. It is up to the caller to apply a Move to its Position
+	// when (and if) that Move is ever visited.
+	// Stored inline so that generating moves never allocates.
+	class MoveVector : public FixedVector<Move, MAX_MOVES>
+	{
+	public:
+		MoveVector() = default;
+		MoveVector(const MoveVector &) = default;
+		MoveVector(MoveVector &&) noexcept = default;
+		~MoveVector() noexcept = default;
+		MoveVector & operator=(const MoveVector &) = default;
+		MoveVector & operator=(MoveVector &&) noexcept = default;
+
+		void print(std::ostream & os = std::cout) const;
+
+		MoveVector::const_iterator find(Move move) const;
+	};
+} // namespace forge
\ No newline at end of file
@@ -27,7 +27,7 @@ namespace forge
 
 			p.makeWhite();
 
-			return pieceValToChar[p.m_val.to_ulong()];
+			return pieceValToChar[p.m_val];
 		}
 
 		void Piece::setCh(char ch, bool isWhite)
@@ -60,43 +60,7 @@ namespace forge
 
 		BitBoard King::pushMask(BoardSquare square)
 		{
-			BitBoard bb;
-
-			// TODO: Optimize: Make this with only bitwise operations. No "if"s
-			// Use shift operations
-			// --- Top 3 squares ---
-			if (square.isTopRank() == false) {
-				bb[square.upOne()] = 1;
-
-				if (square.isLeftFile() == false) {
-					bb[square.upLeftOne()] = 1;
-				}
-				if (square.isRightFile() == false) {
-					bb[square.upRightOne()] = 1;
-				}
-			}
-
-			// --- Middle 3 squares ---
-			if (square.isLeftFile() == false) {
-				bb[square.leftOne()] = 1;
-			}
-			if (square.isRightFile() == false) {
-				bb[square.rightOne()] = 1;
-			}
-
-			// --- Bottom 3 squares ---
-			if (square.isBotRank() == false) {
-				bb[square.downOne()] = 1;
-
-				if (square.isLeftFile() == false) {
-					bb[square.downLeftOne()] = 1;
-				}
-				if (square.isRightFile() == false) {
-					bb[square.downRightOne()] = 1;
-				}
-			}
-
-			return bb;
+			return tables::kings[square.val()];
 		}
 
 		BitBoard Queen::pushMask(BoardSquare square)
@@ -106,64 +70,31 @@ namespace forge
 
 		BitBoard Bishop::pushMask(BoardSquare square)
 		{
-			BitBoard bb;
-
-			const BitBoard POS_DIAGONAL = 0b00000001'00000010'00000100'00001000'00010000'00100000'01000000'10000000;
-			const BitBoard NEG_DIAGONAL = 0b10000000'01000000'00100000'00010000'00001000'00000100'00000010'00000001;
-
-			int mainShift = 7 - (square.row() + square.col());
-			int inverseShift = square.row() - square.col();
-
-			if (mainShift > 0) {
-				bb |= (POS_DIAGONAL >> (mainShift << 3));
-			}
-			else {
-				bb |= (POS_DIAGONAL << (-mainShift << 3));
-			}
-
-			if (inverseShift > 0) {
-				bb |= (NEG_DIAGONAL << (inverseShift << 3));
-			}
-			else {
-				bb |= (NEG_DIAGONAL >> (-inverseShift << 3));
-			}
-
-			bb[square] = 0;	// Clear bit where piece is standing
-
-			return bb;
+			// Clear bit where piece is standing
+			return tables::diagonals[square.val()] & ~(1ull << square.val());
 		}
 
 		BitBoard Knight::pushMask(BoardSquare square)
 		{
-			return BitBoard::mask<directions::LShape>(square);
+			return tables::knights[square.val()];
 		}
 
 		BitBoard Rook::pushMask(BoardSquare square)
 		{
-			BitBoard bb;
-
-			const BitBoard TOP = 0b00000000'00000000'00000000'00000000'00000000'00000000'00000000'11111111;
-			const BitBoard LEFT = 0b00000001'00000001'00000001'00000001'00000001'00000001'00000001'00000001;
-
-			bb =
-				(TOP << (square.row() << 3)) |
-				(LEFT << square.col());
-
-			bb[square] = 0;	// Clear bit where piece is standing
-
-			return bb;
+			// Clear bit where piece is standing
+			return tables::laterals[square.val()] & ~(1ull << square.val());
 		}
 
 		BitBoard WhitePawn::pushMask(BoardSquare square)
 		{
-			BitBoard bb;
+			const BitBoard pawn = BitBoard::square(square);
 
 			// --- Single Push ---
-			bb[square.upOne()] = 1;
+			BitBoard bb = pawn >> 8;
 
 			// --- Double Push ---
 			if (square.row() == 6) {
-				bb[square.up(2)] = 1;
+				bb |= pawn >> 16;
 			}
 
 			return bb;
@@ -171,36 +102,25 @@ namespace forge
 
 		BitBoard WhitePawn::captureMask(BoardSquare square)
 		{
-			BitBoard bb;
+			const BitBoard pawn = BitBoard::square(square);
 
-			// *** Does not need vertical bounds checking ***
-			// *** because pawns can't be on top or bottom rank ***
-
-			// TODO: Optimize: Try to use bit shifts instead of if 
-
-			// --- Left Capture ---
-			if (square.isLeftFile() == false) {
-				bb[square.upLeftOne()] = 1;
-			}
-
-			// --- Right Capture ---
-			if (square.isRightFile() == false) {
-				bb[square.upRightOne()] = 1;
-			}
-
-			return bb;
+			// Bits shifted off the top of the board are dropped.
+			// Bits that wrap onto the other side of the board are masked off.
+			return
+				((pawn >> 9) & ~BitBoard{ tables::FILE_H }) |	// Left Capture
+				((pawn >> 7) & ~BitBoard{ tables::FILE_A });	// Right Capture
 		}
 
 		BitBoard BlackPawn::pushMask(BoardSquare square)
 		{
-			BitBoard bb;
+			const BitBoard pawn = BitBoard::square(square);
 
 			// --- Single Push ---
-			bb[square.downOne()] = 1;
+			BitBoard bb = pawn << 8;
 
 			// --- Double Push ---
 			if (square.row() == 1) {
-				bb[square.down(2)] = 1;
+				bb |= pawn << 16;
 			}
 
 			return bb;
@@ -208,24 +128,13 @@ namespace forge
 
 		BitBoard BlackPawn::captureMask(BoardSquare square)
 		{
-			BitBoard bb;
-
-			// *** Does not need vertical bounds checking ***
-			// *** because pawns can't be on top or bottom rank ***
-
-			// TODO: Optimize: Try to use bit shifts instead of if 
+			const BitBoard pawn = BitBoard::square(square);
 
-			// --- Left Capture ---
-			if (square.isLeftFile() == false) {
-				bb[square.downLeftOne()] = 1;
-			}
-
-			// --- Right Capture ---
-			if (square.isRightFile() == false) {
-				bb[square.downRightOne()] = 1;
-			}
-
-			return bb;
+			// Bits shifted off the bottom of the board are dropped.
+			// Bits that wrap onto the other side of the board are masked off.
+			return
+				((pawn << 7) & ~BitBoard{ tables::FILE_H }) |	// Left Capture
+				((pawn << 9) & ~BitBoard{ tables::FILE_A });	// Right Capture
 		}
 
 		// --- These definitions must be place here below other overloads to compile properly ---
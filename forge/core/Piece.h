@@ -4,7 +4,7 @@
 #include "forge/core/Color.h"
 
 #include <iostream>
-#include <bitset>
+#include <type_traits>
 
 #include <guten/color/Color.h>
 #include <guten/termcolor/termcolor.hpp>
@@ -46,17 +46,17 @@ namespace forge
 			static const piece_t PAWN = WHITE_PAWN;
 
 		public:
-			Piece() : m_val(EMPTY) {}
-			Piece(piece_t value) : m_val(value) {}
+			constexpr Piece() : m_val(EMPTY) {}
+			constexpr Piece(piece_t value) : m_val(value) {}
 			Piece(char ch, bool isWhite = true) { setCh(ch, isWhite); }
 			Piece(const Piece &) = default;
 			Piece(Piece &&) noexcept = default;
-			virtual ~Piece() noexcept = default;
+			~Piece() noexcept = default;
 			Piece & operator=(const Piece &) = default;
 			Piece & operator=(Piece &&) noexcept = default;
 
-			bool operator==(const Piece & piece) const { return this->m_val == piece.m_val; }
-			bool operator!=(const Piece & piece) const { return this->m_val != piece.m_val; }
+			constexpr bool operator==(const Piece & piece) const { return this->m_val == piece.m_val; }
+			constexpr bool operator!=(const Piece & piece) const { return this->m_val != piece.m_val; }
 
 			friend std::ostream & operator<<(std::ostream & os, const Piece & p)
 			{
@@ -77,8 +77,8 @@ namespace forge
 				return is;
 			}
 
-			std::bitset<8> val() const { return m_val; }
-			std::bitset<8> & val() { return m_val; }
+			constexpr piece_t val() const { return m_val; }
+			piece_t & val() { return m_val; }
 
 			char getCh() const;
 			colors::Color getColor() const;
@@ -87,24 +87,24 @@ namespace forge
 			// Piece color is set to white by default
 			void setCh(char ch, bool isWhite = true);
 
-			bool isWhite() const { return m_val[3] == 0; }
-			bool isBlack() const { return !isWhite(); }
-			bool isEmpty() const { return m_val == EMPTY || m_val == EMPTY_FLIPPED; }
-			bool isOccupied() const { return !isEmpty(); }
-			bool isKing() const { return (m_val == WHITE_KING) || (m_val == BLACK_KING); }
-			bool isQueen() const { return (m_val == WHITE_QUEEN) || (m_val == BLACK_QUEEN); }
-			bool isRook() const { return (m_val == WHITE_ROOK) || (m_val == BLACK_ROOK); }
-			bool isBishop() const { return (m_val == WHITE_BISHOP) || (m_val == BLACK_BISHOP); }
-			bool isKnight() const { return (m_val == WHITE_KNIGHT) || (m_val == BLACK_KNIGHT); }
-			bool isPawn() const { return (m_val == WHITE_PAWN) || (m_val == BLACK_PAWN); }
-			bool isRay() const { return isQueen() || isRook() || isBishop(); }
+			constexpr bool isWhite() const { return (m_val & color_mask) == 0; }
+			constexpr bool isBlack() const { return !isWhite(); }
+			constexpr bool isEmpty() const { return m_val == EMPTY || m_val == EMPTY_FLIPPED; }
+			constexpr bool isOccupied() const { return !isEmpty(); }
+			constexpr bool isKing() const { return (m_val == WHITE_KING) || (m_val == BLACK_KING); }
+			constexpr bool isQueen() const { return (m_val == WHITE_QUEEN) || (m_val == BLACK_QUEEN); }
+			constexpr bool isRook() const { return (m_val == WHITE_ROOK) || (m_val == BLACK_ROOK); }
+			constexpr bool isBishop() const { return (m_val == WHITE_BISHOP) || (m_val == BLACK_BISHOP); }
+			constexpr bool isKnight() const { return (m_val == WHITE_KNIGHT) || (m_val == BLACK_KNIGHT); }
+			constexpr bool isPawn() const { return (m_val == WHITE_PAWN) || (m_val == BLACK_PAWN); }
+			constexpr bool isRay() const { return isQueen() || isRook() || isBishop(); }
 
 			// Flips color of piece:
 			// black -> white
 			// white -> black
-			void flipColor() { m_val.flip(3); }
-			void makeWhite() { m_val[3] = 0; }
-			void makeBlack() { m_val[3] = 1; }
+			void flipColor() { m_val ^= color_mask; }
+			void makeWhite() { m_val &= ~color_mask; }
+			void makeBlack() { m_val |= color_mask; }
 
 			BitBoard pushMask(BoardSquare square) const;
 
@@ -113,9 +113,17 @@ namespace forge
 			void masks(BoardSquare square, BitBoard & pushMask, BitBoard & captureMask) const;
 
 		protected:
-			std::bitset<8> m_val = 0;
+			// Bit 3 is the color (0: White, 1: Black). Bits 0...2 are the piece type.
+			piece_t m_val = 0;
+
+			static const piece_t color_mask = 0b1000;
 		};
 
+		// Stored in every UndoInfo and copied in and out of Boards. Must stay a plain byte.
+		static_assert(std::is_standard_layout<Piece>() && std::is_trivially_copyable<Piece>(),
+			"Piece must be standard layout and trivially copyable");
+		static_assert(sizeof(Piece) == 1, "Piece must be 1 byte");
+
 		// QBR
 		class RayPiece { };
 
@@ -124,19 +132,19 @@ namespace forge
 		// QBNRP (Not K or Empty)
 		class NonKingPiece { };
 
-		const Piece empty{ Piece::EMPTY };
-		const Piece whiteKing{ Piece::WHITE_KING };
-		const Piece whiteQueen{ Piece::WHITE_QUEEN };
-		const Piece whiteBishop{ Piece::WHITE_BISHOP };
-		const Piece whiteKnight{ Piece::WHITE_KNIGHT };
-		const Piece whiteRook{ Piece::WHITE_ROOK };
-		const Piece whitePawn{ Piece::WHITE_PAWN };
-		const Piece blackKing{ Piece::BLACK_KING };
-		const Piece blackQueen{ Piece::BLACK_QUEEN };
-		const Piece blackBishop{ Piece::BLACK_BISHOP };
-		const Piece blackKnight{ Piece::BLACK_KNIGHT };
-		const Piece blackRook{ Piece::BLACK_ROOK };
-		const Piece blackPawn{ Piece::BLACK_PAWN };
+		constexpr Piece empty{ Piece::EMPTY };
+		constexpr Piece whiteKing{ Piece::WHITE_KING };
+		constexpr Piece whiteQueen{ Piece::WHITE_QUEEN };
+		constexpr Piece whiteBishop{ Piece::WHITE_BISHOP };
+		constexpr Piece whiteKnight{ Piece::WHITE_KNIGHT };
+		constexpr Piece whiteRook{ Piece::WHITE_ROOK };
+		constexpr Piece whitePawn{ Piece::WHITE_PAWN };
+		constexpr Piece blackKing{ Piece::BLACK_KING };
+		constexpr Piece blackQueen{ Piece::BLACK_QUEEN };
+		constexpr Piece blackBishop{ Piece::BLACK_BISHOP };
+		constexpr Piece blackKnight{ Piece::BLACK_KNIGHT };
+		constexpr Piece blackRook{ Piece::BLACK_ROOK };
+		constexpr Piece blackPawn{ Piece::BLACK_PAWN };
 
 		class Empty : public Piece {
 		public:
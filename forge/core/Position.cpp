@@ -1,4 +1,5 @@
 #include "forge/core/Position.h"
+#include "forge/core/MagicBitBoards.h"
 
 #include <sstream>
 
@@ -6,6 +7,11 @@ using namespace std;
 
 namespace forge
 {
+	Position::Position()
+	{
+		updateAttacks();
+	}
+
 	Position::Position(const std::string& fen)
 	{
 		this->fromFEN(fen);
@@ -25,6 +31,8 @@ namespace forge
 		m_fiftyMoveRule.reset();
 
 		m_moveCounter.reset();
+
+		updateAttacks();
 	}
 
 	void Position::clear()
@@ -34,6 +42,108 @@ namespace forge
 		m_fiftyMoveRule.reset();
 
 		m_moveCounter.reset();
+
+		updateAttacks();
+	}
+
+	namespace
+	{
+		const uint64_t NOT_LEFT_FILE = ~0x01'01'01'01'01'01'01'01ull;
+		const uint64_t NOT_RIGHT_FILE = ~0x80'80'80'80'80'80'80'80ull;
+
+		// Squares that block the sliders of 'side'. The King of the other side never does.
+		BitBoard sliderObstacles(const Board & b, color_t side)
+		{
+			const BitBoard theirKing = BitBoard::square(side == WHITE ? b.blackKing() : b.whiteKing());
+
+			return b.occupied() & ~theirKing;
+		}
+
+		// Squares attacked by the Queens, Rooks and Bishops of 'side'
+		BitBoard sliderAttacks(const Board & b, color_t side)
+		{
+			const BitBoard ours = (side == WHITE ? b.whites() : b.blacks());
+			const BitBoard obstacles = sliderObstacles(b, side);
+			BitBoard attacks;
+
+			for (BoardSquare rook : b.laterals() & ours) {
+				attacks |= MagicBitBoards::rookAttacks(rook, obstacles);
+			}
+
+			for (BoardSquare bishop : b.diagonals() & ours) {
+				attacks |= MagicBitBoards::bishopAttacks(bishop, obstacles);
+			}
+
+			return attacks;
+		}
+
+		// Squares attacked by the Pawns, Knights and King of 'side'
+		// Pawns are handled all at once with 2 shifts.
+		BitBoard leaperAttacks(const Board & b, color_t side)
+		{
+			const BitBoard ours = (side == WHITE ? b.whites() : b.blacks());
+			const uint64_t pawns = (b.pawns() & ours).bits();
+
+			uint64_t attacks = (side == WHITE ?
+				((pawns >> 9) & NOT_RIGHT_FILE) | ((pawns >> 7) & NOT_LEFT_FILE) :
+				((pawns << 7) & NOT_RIGHT_FILE) | ((pawns << 9) & NOT_LEFT_FILE));
+
+			for (BoardSquare knight : b.knights() & ours) {
+				attacks |= tables::knights[knight.val()];
+			}
+
+			attacks |= tables::kings[(side == WHITE ? b.whiteKing() : b.blackKing()).val()];
+
+			return BitBoard{ attacks };
+		}
+	} // namespace
+
+	void Position::updateAttacks()
+	{
+		for (color_t side : { WHITE, BLACK }) {
+			m_sliderAttacks[side] = sliderAttacks(m_board, side);
+			m_attacks[side] = m_sliderAttacks[side] | leaperAttacks(m_board, side);
+		}
+	}
+
+	void Position::placePiece(BoardSquare square, pieces::Piece piece)
+	{
+		m_board.placePiece(square, piece);
+
+		updateAttacks();
+	}
+
+	void Position::updateAttacks(Move move, bool capturesSlider)
+	{
+		const BoardSquare from = move.from();
+		const BoardSquare to = move.to();
+		const color_t mover = m_board.isWhite(to);
+
+		for (color_t side : { WHITE, BLACK }) {
+			const BitBoard ours = (side == WHITE ? m_board.whites() : m_board.blacks());
+			const BitBoard laterals = m_board.laterals() & ours;
+			const BitBoard diagonals = m_board.diagonals() & ours;
+
+			// Slider attacks only change when:
+			//	- one of this side's sliders moved (or was promoted to), or was captured
+			//	- one of this side's sliders sees 'from' or 'to'. Every other square kept its piece.
+			bool isStale =
+				(side == mover ? m_board.rays()[to] : capturesSlider);
+
+			if (isStale == false && (laterals | diagonals).any()) {
+				const BitBoard obstacles = sliderObstacles(m_board, side);
+
+				isStale =
+					((MagicBitBoards::rookAttacks(from, obstacles) | MagicBitBoards::rookAttacks(to, obstacles)) & laterals).any() ||
+					((MagicBitBoards::bishopAttacks(from, obstacles) | MagicBitBoards::bishopAttacks(to, obstacles)) & diagonals).any();
+			}
+
+			if (isStale) {
+				m_sliderAttacks[side] = sliderAttacks(m_board, side);
+			}
+
+			m_attacks[side] = m_sliderAttacks[side] | leaperAttacks(m_board, side);
+		}
 	}
 
 	void Position::fromFEN(const std::string& fen)
@@ -46,7 +156,7 @@ namespace forge
 
 		// 1.) --- Board and Pieces ---
 		{
-			Board& b = this->board();
+			Board& b = this->m_board;
 
 			// Move Kings to lower right corner so that they don't interfer with piece placement
 			b.place<pieces::WhiteKing>(BoardSquare{ 7, 7 });
@@ -107,7 +217,10 @@ namespace forge
 		// 6.) --- Full move count ---
 		int fullMoveCount;
 		ss >> fullMoveCount;
-		this->m_moveCounter.count = fullMoveCount - 1 + (isWhite ? 0 : 1);
+		// Full moves start at 1 and count 2 half moves each.
+		this->m_moveCounter.count = (fullMoveCount - 1) * 2 + (isWhite ? 0 : 1);
+
+		updateAttacks();
 	}
 
 	string Position::toFEN() const
@@ -117,39 +230,37 @@ namespace forge
 		// 1.) --- Board and Pieces ---
 		{
 			const Board& b = this->board();
-			uint16_t emptyCount = 0;
 
 			for (uint16_t row = 0; row < 8; row++) {
-				for (uint16_t col = 0; col < 8; col++) {
-					BoardSquare bs{ row, col };
+				const BitBoard rowMask = 0xFFull << (8 * row);
+				uint16_t col = 0;	// Column right after the last piece written
 
-					if (b.isEmpty(bs)) {
-						emptyCount++;
+				// Only visit occupied squares. Empty squares in between are counted from the gaps.
+				for (BoardSquare bs : b.occupied() & rowMask) {
+					uint16_t emptyCount = bs.col() - col;
+
+					if (emptyCount != 0) {
+						ss << emptyCount;
 					}
-					else {
-						if (emptyCount != 0) {
-							ss << emptyCount;
-						}
-						emptyCount = 0;
-
-						char ch = ' ';
-
-						if (b.isKing(bs)) ch = 'k';
-						else if (b.isQueen(bs)) ch = 'q';
-						else if (b.isBishop(bs)) ch = 'b';
-						else if (b.isKnight(bs)) ch = 'n';
-						else if (b.isRook(bs)) ch = 'r';
-						else if (b.isPawn(bs)) ch = 'p';
-
-						if (b.isWhite(bs)) ch = toupper(ch);
-
-						ss << ch;
-					} // is not empty
-				} // for (col = 0
-
-				if (emptyCount != 0) {
-					ss << emptyCount;
-					emptyCount = 0;
+
+					char ch = ' ';
+
+					if (b.isKing(bs)) ch = 'k';
+					else if (b.isQueen(bs)) ch = 'q';
+					else if (b.isBishop(bs)) ch = 'b';
+					else if (b.isKnight(bs)) ch = 'n';
+					else if (b.isRook(bs)) ch = 'r';
+					else if (b.isPawn(bs)) ch = 'p';
+
+					if (b.isWhite(bs)) ch = toupper(ch);
+
+					ss << ch;
+
+					col = bs.col() + 1;
+				} // for (bs
+
+				if (col != 8) {
+					ss << 8 - col;
 				}
 
 				if (row != 7) {
@@ -189,11 +300,15 @@ namespace forge
 		}
 #endif // _DEBUG
 
+		const bool capturesSlider = m_board.rays()[move.to()];
+
 		m_board.move<pieces::WhiteKing>(move);
 
 		m_fiftyMoveRule.update();
 		// TODO: Castling
 
+		updateAttacks(move, capturesSlider);
+
 		m_moveCounter++;
 	}
 
@@ -206,11 +321,15 @@ namespace forge
 		}
 #endif // _DEBUG
 
+		const bool capturesSlider = m_board.rays()[move.to()];
+
 		m_board.move<pieces::BlackKing>(move);
 
 		m_fiftyMoveRule.update();
 		// TODO: Castling
 
+		updateAttacks(move, capturesSlider);
+
 		m_moveCounter++;
 	}
 
@@ -233,6 +352,8 @@ namespace forge
 
 	template<> void Position::move<pieces::Queen>(Move move)
 	{
+		const bool capturesSlider = m_board.rays()[move.to()];
+
 		// --- Was this a capture? ---
 		if (m_board.isOccupied(move.to()))
 			m_fiftyMoveRule.pieceCaptured();	// Yes. Capture occured
@@ -241,11 +362,15 @@ namespace forge
 
 		m_fiftyMoveRule.update();
 
+		updateAttacks(move, capturesSlider);
+
 		m_moveCounter++;
 	}
 
 	template<> void Position::move<pieces::Bishop>(Move move)
 	{
+		const bool capturesSlider = m_board.rays()[move.to()];
+
 		// --- Was this a capture? ---
 		if (m_board.isOccupied(move.to()))
 			m_fiftyMoveRule.pieceCaptured();	// Yes. Capture occured
@@ -254,11 +379,15 @@ namespace forge
 
 		m_fiftyMoveRule.update();
 
+		updateAttacks(move, capturesSlider);
+
 		m_moveCounter++;
 	}
 
 	template<> void Position::move<pieces::Knight>(Move move)
 	{
+		const bool capturesSlider = m_board.rays()[move.to()];
+
 		// --- Was this a capture? ---
 		if (m_board.isOccupied(move.to()))
 			m_fiftyMoveRule.pieceCaptured();	// Yes. Capture occured
@@ -267,11 +396,15 @@ namespace forge
 
 		m_fiftyMoveRule.update();
 
+		updateAttacks(move, capturesSlider);
+
 		m_moveCounter++;
 	}
 
 	template<> void Position::move<pieces::QBN_Piece>(Move move)
 	{
+		const bool capturesSlider = m_board.rays()[move.to()];
+
 		// --- Was this a capture? ---
 		if (m_board.isOccupied(move.to()))
 			m_fiftyMoveRule.pieceCaptured();	// Yes. Capture occured
@@ -280,11 +413,15 @@ namespace forge
 
 		m_fiftyMoveRule.update();
 
+		updateAttacks(move, capturesSlider);
+
 		m_moveCounter++;
 	}
 
 	template<> void Position::move<pieces::Rook>(Move move)
 	{
+		const bool capturesSlider = m_board.rays()[move.to()];
+
 		// --- Was this a capture? ---
 		if (m_board.isOccupied(move.to()))
 			m_fiftyMoveRule.pieceCaptured();	// Yes. Capture occured
@@ -295,6 +432,8 @@ namespace forge
 
 		// TODO: Don't forget castling
 
+		updateAttacks(move, capturesSlider);
+
 		m_moveCounter++;
 	}
 
@@ -306,19 +445,23 @@ namespace forge
 			<< ": This method only moves white pawns\n";
 #endif
 
+		const bool capturesSlider = m_board.rays()[move.to()];
+
 		// --- Was this a capture? ---
 		if (m_board.isOccupied(move.to()))
 			m_fiftyMoveRule.pieceCaptured();	// Yes. Capture occured
 
 		m_board.place<pieces::Empty>(move.from(), bool());	// bool() is a place holder
 
-		if (move.to().isTopRank()) {m_board.placePiece(move.to(), move.promotion()); }
+		if (move.isPromotion()) { m_board.placePiece(move.to(), move.promotion()); }
 		else m_board.place<pieces::WhitePawn>(move.to());
 
 		m_fiftyMoveRule.pawnHasMoved();
 		m_fiftyMoveRule.update();
 		// TODO: ENPASSENT
 
+		updateAttacks(move, capturesSlider);
+
 		m_moveCounter++;
 	}
 
@@ -329,6 +472,8 @@ namespace forge
 			std::cout << "Error " << __FUNCTION__ << " line " << __LINE__
 			<< ": This method only moves black pawns\n";
 #endif
+
+		const bool capturesSlider = m_board.rays()[move.to()];
 		
 		// --- Was this a capture? ---
 		if (m_board.isOccupied(move.to()))
@@ -336,13 +481,15 @@ namespace forge
 
 		m_board.place<pieces::Empty>(move.from(), bool());	// bool() is a place holder
 
-		if (move.to().isBotRank()) { m_board.placePiece(move.to(), move.promotion()); }
+		if (move.isPromotion()) { m_board.placePiece(move.to(), move.promotion()); }
 		else m_board.place<pieces::BlackPawn>(move.to());
 
 		m_fiftyMoveRule.pawnHasMoved();
 		m_fiftyMoveRule.update();
 		// TODO: Still need enpassent 
 
+		updateAttacks(move, capturesSlider);
+
 		m_moveCounter++;
 	}
 
@@ -361,6 +508,13 @@ namespace forge
 	// For support for promotions, see Position::move<pieces::Pawn>();
 	template<> void Position::move<pieces::Piece>(Move move)
 	{
+		// Only Pawns promote. White Pawns promote on the top rank.
+		if (move.isPromotion()) {
+			if (move.to().isTopRank())	this->move<pieces::WhitePawn>(move);
+			else						this->move<pieces::BlackPawn>(move);
+			return;
+		}
+
 		pieces::Piece p = m_board.at(move.from());
 
 		if (p.isPawn()) {
@@ -380,6 +534,50 @@ namespace forge
 		}
 	}
 
+	void Position::makeMove(Move move, UndoInfo & undo)
+	{
+		// 1.) --- Remember everything this move is about to overwrite ---
+		undo.moved = m_board.at(move.from());
+		undo.captured = m_board.at(move.to());
+		undo.enPassent = m_board.en_passent();
+		undo.fiftyMoveRule = m_fiftyMoveRule;
+		undo.moveCounter = m_moveCounter;
+		undo.attacks[WHITE] = m_attacks[WHITE];
+		undo.attacks[BLACK] = m_attacks[BLACK];
+		undo.sliderAttacks[WHITE] = m_sliderAttacks[WHITE];
+		undo.sliderAttacks[BLACK] = m_sliderAttacks[BLACK];
+
+		// 2.) --- Apply move ---
+		this->move<pieces::Piece>(move);
+	}
+
+	void Position::unmakeMove(Move move, const UndoInfo & undo)
+	{
+#ifdef _DEBUG
+		if (m_board.isEmpty(move.to())) {
+			std::cout << "Error " << __FUNCTION__ << " line " << __LINE__
+				<< ": " << move << " was not the last move made\n";
+		}
+#endif // _DEBUG
+
+		// 1.) --- Put moving piece back where it came from ---
+		// Also undoes promotions because the original piece (a Pawn) is placed.
+		// Kings are moved simply by placing them.
+		m_board.placePiece(move.from(), undo.moved);
+
+		// 2.) --- Put back captured piece (or empty square) ---
+		m_board.placePiece(move.to(), undo.captured);
+
+		// 3.) --- Restore everything else ---
+		m_board.en_passent(undo.enPassent);
+		m_fiftyMoveRule = undo.fiftyMoveRule;
+		m_moveCounter = undo.moveCounter;
+		m_attacks[WHITE] = undo.attacks[WHITE];
+		m_attacks[BLACK] = undo.attacks[BLACK];
+		m_sliderAttacks[WHITE] = undo.sliderAttacks[WHITE];
+		m_sliderAttacks[BLACK] = undo.sliderAttacks[BLACK];
+	}
+
 	std::ostream& operator<<(std::ostream& os, const Position& pos)
 	{
 		os << pos.toFEN();
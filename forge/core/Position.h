@@ -4,6 +4,7 @@
 #include "forge/core/MoveCounter.h"
 #include "forge/core/FiftyMoveRule.h"
 #include "forge/core/HashCombine.h"
+#include "forge/core/UndoInfo.h"
 
 #include <type_traits>
 
@@ -28,7 +29,7 @@ namespace forge
 
 		// --- Constructors ---
 
-		Position() = default;
+		Position();
 		Position(const Position&) = default;
 		Position(Position&&) noexcept = default;
 		Position(const std::string& fen);
@@ -71,11 +72,41 @@ namespace forge
 
 		// TODO: Add capture() and push() versions of move() that will be more efficient
 
+		// ----- In place make/unmake -----
+		// Applies 'move' to this Position and records in 'undo' everything needed to take
+		// it back with unmakeMove(). 
+		// Lets a search walk the game tree on a single Position instead of copying
+		// a Position for every node.
+		// Works with captures and promotions.
+		void makeMove(Move move, UndoInfo & undo);
+
+		// Takes back 'move' which must be the last move applied with makeMove().
+		// 'undo' must be the record makeMove() filled for 'move'.
+		// Restores captured piece, 50 move rule, move counter and en passent bits.
+		void unmakeMove(Move move, const UndoInfo & undo);
+
+		// ----- Attack Maps -----
+		// Squares attacked by the pieces of 'side'.
+		// Kept up to date by move<>(), makeMove() and unmakeMove() instead of being
+		// generated from scratch for every Position.
+		// Sliders see through the King of the other side. The squares behind that King are 
+		// attacked too because the King can't step back along the ray to escape it.
+		const BitBoard & attacks(color_t side) const { return m_attacks[side]; }
+
+		// Recomputes both attack maps from scratch.
+		void updateAttacks();
+
+		// ----- Editing -----
+		// The Board is only editable through these methods so that the attack maps never go stale.
+		// Optimization: Not intended to be used in performance critical code.
+
+		// Same as Board::placePiece() but also recomputes the attack maps.
+		void placePiece(BoardSquare square, pieces::Piece piece);
+
 		// --- NOTATIONS ---
 		void fromFEN(const std::string& fen);
 		std::string toFEN() const;
 
-		Board & board() { return m_board; }
 		const Board & board() const { return m_board; }
 		const FiftyMoveRule & fiftyMoveRule() const { return m_fiftyMoveRule; }
 		const MoveCounter & moveCounter() const { return m_moveCounter; }
@@ -120,7 +151,26 @@ namespace forge
 
 		// Number of moves played
 		MoveCounter m_moveCounter;
+
+		// Squares attacked by each side. Indexed by color_t. See attacks()
+		BitBoard m_attacks[2];
+
+		// Part of 'm_attacks' made by sliders (Queens, Rooks and Bishops).
+		// Most moves don't change it so it is only recomputed when a slider's rays pass through
+		// a square the move touched.
+		BitBoard m_sliderAttacks[2];
+
+	private:
+		// Updates attack maps after 'move' was applied to the Board.
+		// capturesSlider - true when 'move' captured a Queen, Rook or Bishop.
+		// Called at the end of every move<>() that moves a piece.
+		void updateAttacks(Move move, bool capturesSlider);
 	};
+
+	// Lets containers of Positions (and MovePositionPairs) grow with memcpy and
+	// lets Positions be written to and read from raw memory.
+	static_assert(std::is_standard_layout<Position>() && std::is_trivially_copyable<Position>(),
+		"Position must be standard layout and trivially copyable");
 } // namespace forge
 
 // --- Inject hash into std namespace
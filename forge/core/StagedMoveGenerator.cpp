@@ -0,0 +1,180 @@
+#include "forge/core/StagedMoveGenerator.h"
+#include "forge/core/MagicBitBoards.h"
+
+#include "forge/feature_extractor/AttackChecker.h"
+
+using namespace std;
+
+namespace forge
+{
+	StagedMoveGenerator::StagedMoveGenerator(
+		const Position & position,
+		Move hashMove,
+		Move killer1,
+		Move killer2) :
+		m_positionPtr(&position),
+		m_hashMove(hashMove),
+		m_killers{ killer1, killer2 }
+	{}
+
+	bool StagedMoveGenerator::next(Move & move)
+	{
+		const Position & pos = *m_positionPtr;
+
+		while (m_stage != Stage::DONE) {
+			switch (m_stage) {
+			case Stage::HASH_MOVE:
+				if (m_index == 0) {
+					m_index++;
+
+					if (isLegal(pos, m_hashMove)) {
+						m_hashMoveYielded = true;
+						move = m_hashMove;
+						return true;
+					}
+				}
+				break;
+
+			case Stage::KILLERS:
+				while (m_index < 2) {
+					Move killer = m_killers[m_index];
+					bool & yielded = m_killerYielded[m_index];
+					m_index++;
+
+					// Killers are quiet moves. Captures and promotions were already yielded.
+					if (killer.isPromotion() || pos.board().isOccupied(killer.to())) continue;
+					if (wasYielded(killer)) continue;	// Duplicate of hash move or other killer
+
+					if (isLegal(pos, killer)) {
+						yielded = true;
+						move = killer;
+						return true;
+					}
+				}
+				break;
+
+			case Stage::CAPTURES:
+			case Stage::QUIETS:
+			{
+				const MoveVector & moves = m_movegen.legalMoveVector;
+
+				while (m_index < moves.size()) {
+					Move candidate = moves[m_index++];
+
+					if (wasYielded(candidate) == false) {
+						move = candidate;
+						return true;
+					}
+				}
+				break;
+			}
+
+			default:
+				break;
+			}
+
+			// --- Current stage has no more moves ---
+			nextStage();
+		}
+
+		return false;
+	}
+
+	void StagedMoveGenerator::nextStage()
+	{
+		m_index = 0;
+
+		switch (m_stage) {
+		case Stage::HASH_MOVE:
+			m_stage = Stage::CAPTURES;
+			m_movegen.genLegalMoves(*m_positionPtr, MoveGenerator2::Mode::MOVES_ONLY, MoveGenerator2::Filter::CAPTURES_AND_PROMOTIONS);
+			break;
+		case Stage::CAPTURES:
+			m_stage = Stage::KILLERS;
+			break;
+		case Stage::KILLERS:
+			m_stage = Stage::QUIETS;
+			m_movegen.genLegalMoves(*m_positionPtr, MoveGenerator2::Mode::MOVES_ONLY, MoveGenerator2::Filter::QUIETS);
+			break;
+		case Stage::QUIETS:
+		default:
+			m_stage = Stage::DONE;
+			break;
+		}
+	}
+
+	bool StagedMoveGenerator::wasYielded(Move move) const
+	{
+		return
+			(m_hashMoveYielded && move == m_hashMove) ||
+			(m_killerYielded[0] && move == m_killers[0]) ||
+			(m_killerYielded[1] && move == m_killers[1]);
+	}
+
+	bool StagedMoveGenerator::isLegal(const Position & position, Move move)
+	{
+		if (move.isInvalid() || move.isPartial()) return false;
+
+		// Never generated yet
+		if (move.isEnPassant() || move.isCastling()) return false;
+
+		const Board & b = position.board();
+		const bool isWhitesTurn = position.isWhitesTurn();
+		const BitBoard ours = (isWhitesTurn ? b.whites() : b.blacks());
+		const BitBoard theirs = (isWhitesTurn ? b.blacks() : b.whites());
+		const BoardSquare from = move.from();
+		const BoardSquare to = move.to();
+
+		// 1.) --- Must move one of our pieces to a square without our pieces ---
+		if (ours[from] == false || ours[to]) return false;
+
+		// Kings can never be captured
+		if (to == b.whiteKing() || to == b.blackKing()) return false;
+
+		// 2.) --- Can the piece reach 'to'? ---
+		const pieces::Piece piece = b.at(from);
+		BitBoard reach;
+
+		if (piece.isPawn()) {
+			BitBoard pushes = (isWhitesTurn ? pieces::WhitePawn::pushMask(from) : pieces::BlackPawn::pushMask(from));
+			BitBoard captures = (isWhitesTurn ? pieces::WhitePawn::captureMask(from) : pieces::BlackPawn::captureMask(from));
+
+			// Pushes can't jump over or land on pieces
+			BitBoard empty = b.empty();
+			BoardSquare push1 = (isWhitesTurn ? from.upOne() : from.downOne());
+			if (empty[push1] == false) pushes.reset();
+
+			reach = (pushes & empty) | (captures & theirs);
+
+			// Promotion must be to one of our Queens, Rooks, Bishops or Knights
+			// exactly when the Pawn lands on its last rank.
+			bool isLastRank = (isWhitesTurn ? to.isTopRank() : to.isBotRank());
+			pieces::Piece promotion = move.promotion();
+
+			if (isLastRank) {
+				if (promotion.isEmpty() || promotion.isKing() || promotion.isPawn()) return false;
+				if (promotion.isWhite() != isWhitesTurn) return false;
+			}
+			else if (move.isPromotion()) {
+				return false;
+			}
+		}
+		else {
+			if (move.isPromotion()) return false;
+
+			if (piece.isKnight())		reach = pieces::Knight::pushMask(from);
+			else if (piece.isKing())	reach = pieces::King::pushMask(from);
+			else if (piece.isRook())	reach = MagicBitBoards::rookAttacks(from, b.occupied());
+			else if (piece.isBishop())	reach = MagicBitBoards::bishopAttacks(from, b.occupied());
+			else if (piece.isQueen())	reach = MagicBitBoards::queenAttacks(from, b.occupied());
+		}
+
+		if (reach[to] == false) return false;
+
+		// 3.) --- Does it leave our King safe? ---
+		Position next = position;
+		next.move<pieces::Piece>(move);
+
+		return AttackChecker::isKingAttacked(next.board(), isWhitesTurn) == false;
+	}
+} // namespace forge
\ No newline at end of file
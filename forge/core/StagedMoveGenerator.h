@@ -0,0 +1,77 @@
+#pragma once
+
+#include "forge/core/MoveGenerator2.h"
+
+#include <stdint.h>
+
+namespace forge
+{
+	// Yields the legal moves of a Position one at a time in stages:
+	//	1. Hash move (ex: best move from a transposition table)
+	//	2. Captures and promotions
+	//	3. Killer moves (quiet moves that caused a cutoff in a sibling node)
+	//	4. Quiet moves
+	// Each stage is only generated once the stage before it runs out of moves,
+	// so a search that cuts off early never pays for generating quiet moves.
+	// Every move is yielded exactly once.
+	// Hash and killer moves are verified to be legal and are skipped if not.
+	// ex:
+	//	StagedMoveGenerator movegen{ pos, hashMove, killer1, killer2 };
+	//	Move move;
+	//	while (movegen.next(move)) { ... }
+	class StagedMoveGenerator
+	{
+	public:
+		enum class Stage : uint8_t {
+			HASH_MOVE,
+			CAPTURES,
+			KILLERS,
+			QUIETS,
+			DONE,
+		};
+
+		// 'position' must outlive this object.
+		// Pass a default constructed Move for any move that is not known.
+		StagedMoveGenerator(
+			const Position & position,
+			Move hashMove = Move{},
+			Move killer1 = Move{},
+			Move killer2 = Move{});
+
+		// Gets the next legal move.
+		// Returns false (and leaves 'move' unchanged) once every legal move has been yielded.
+		bool next(Move & move);
+
+		// Stage of the move last returned by next().
+		Stage stage() const { return m_stage; }
+
+		// Returns true iff 'move' is a legal move of 'position'.
+		// Slower than generating moves in bulk, but does not need to know any other moves.
+		static bool isLegal(const Position & position, Move move);
+
+	private:
+		// Moves the stage forward and generates its moves if it has any.
+		void nextStage();
+
+		// Was 'move' already yielded by the hash move or killer stages?
+		bool wasYielded(Move move) const;
+
+		const Position * m_positionPtr = nullptr;
+
+		Move m_hashMove;
+		Move m_killers[2];
+
+		// Which of the above were legal and yielded already
+		bool m_hashMoveYielded = false;
+		bool m_killerYielded[2] = { false, false };
+
+		Stage m_stage = Stage::HASH_MOVE;
+
+		// Index of the next move of the current stage
+		// For CAPTURES and QUIETS: index into the generated moves
+		// For KILLERS: index into m_killers
+		size_t m_index = 0;
+
+		MoveGenerator2 m_movegen;
+	};
+} // namespace forge
\ No newline at end of file
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "forge/core/BitBoard.h"
+#include "forge/core/FiftyMoveRule.h"
+#include "forge/core/MoveCounter.h"
+#include "forge/core/Piece.h"
+
+namespace forge
+{
+	// Everything Position::makeMove() destroys that Position::unmakeMove() needs
+	// to put back.
+	// Filled by Position::makeMove(). Should only be passed to Position::unmakeMove()
+	// along with the same Move.
+	struct UndoInfo
+	{
+		// Piece that made the move. (Before any promotion)
+		pieces::Piece moved;
+
+		// Piece that stood on the destination square. 
+		// pieces::empty if the move was not a capture.
+		pieces::Piece captured;
+
+		// En passent bits of the Board (Ranks 1 and 8 of the pawn BitBoard)
+		BitBoard enPassent;
+
+		FiftyMoveRule fiftyMoveRule;
+
+		MoveCounter moveCounter;
+
+		// Attack maps of the Position. See Position::attacks()
+		BitBoard attacks[2];
+		BitBoard sliderAttacks[2];
+	};
+} // namespace forge
\ No newline at end of file
@@ -1,44 +1,11 @@
 #include "forge/feature_extractor/AttackChecker.h"
+#include "forge/feature_extractor/KoggeStone.h"
+#include "forge/core/MagicBitBoards.h"
+
+#include <algorithm>
 
 namespace forge
 {
-
-#ifndef FORGE_FIND_STRAIGHT_ATTACK
-#define FORGE_FIND_STRAIGHT_ATTACK(ORIGIN_CELL, MOVE_FUNC, BOUNDS_CHECK_FUNC) \
-	{ \
-		BoardSquare c = ORIGIN_CELL; \
-		while (c.BOUNDS_CHECK_FUNC() == false) { \
-			c = c.MOVE_FUNC(); \
-			if (board.occupied()[c]) { \
-				if (theirs[c]) { \
-					if (board.m_rooks[c]) { \
-						return true; \
-					} \
-				} \
-				break; \
-			} \
-		} \
-	}
-#endif
-
-#ifndef FORGE_FIND_DIAGONAL_ATTACK
-#define FORGE_FIND_DIAGONAL_ATTACK(ORIGIN_CELL, MOVE_FUNC, BOUNDS_CHECK_FUNC1, BOUNDS_CHECK_FUNC2) \
-	{ \
-		BoardSquare c = ORIGIN_CELL; \
-		while (c.BOUNDS_CHECK_FUNC1() == false && c.BOUNDS_CHECK_FUNC2() == false) { \
-			c = c.MOVE_FUNC(); \
-			if (board.occupied()[c]) { \
-				if (theirs[c]) { \
-					if (board.m_bishops[c]) { \
-						return true; \
-					} \
-				} \
-				break; \
-			} \
-		} \
-	}
-#endif
-
 	bool AttackChecker::isAttacked(const Board & board, BoardSquare square)
 	{
 		// 1.) --- Look for straight attacks (from Rooks and Queens) ---
@@ -60,6 +27,31 @@ namespace forge
 		return false;
 	}
 
+	void AttackChecker::isAttacked(const Board * boards, const BoardSquare * squares, bool * results, size_t count)
+	{
+		// Boards are handed to the kernel in chunks so that nothing has to be allocated.
+		const size_t CHUNK = 64;
+		KoggeStone::Pieces pieces[CHUNK];
+		uint64_t attacks[CHUNK];
+
+		for (size_t begin = 0; begin < count; begin += CHUNK) {
+			const size_t n = std::min(CHUNK, count - begin);
+
+			for (size_t i = 0; i < n; i++) {
+				const Board & board = boards[begin + i];
+				BitBoard theirs = (board.isWhite(squares[begin + i]) ? board.blacks() : board.whites());
+
+				pieces[i] = KoggeStone::piecesOf(board, theirs, board.occupied());
+			}
+
+			KoggeStone::attacks(pieces, attacks, n);
+
+			for (size_t i = 0; i < n; i++) {
+				results[begin + i] = (attacks[i] >> squares[begin + i].val()) & 1;
+			}
+		}
+	}
+
 	bool AttackChecker::isKingAttacked(const Board & board, bool isWhiteKing)
 	{
 		BoardSquare kingSquare = (isWhiteKing ? board.whiteKing() : board.blackKing());
@@ -71,160 +63,49 @@ namespace forge
 	{
 		bool isWhite = board.isWhite(square);
 		BitBoard theirs = (isWhite ? board.blacks() : board.whites());
-		BitBoard ours = (isWhite ? board.whites() : board.blacks());
-
-		// --- Search Up ---
-		FORGE_FIND_STRAIGHT_ATTACK(square, upOne, isTopRank);
-
-		// --- Search Down ---
-		FORGE_FIND_STRAIGHT_ATTACK(square, downOne, isBotRank);
 
-		// --- Search Left ---
-		FORGE_FIND_STRAIGHT_ATTACK(square, leftOne, isLeftFile);
+		// Any of their Rooks or Queens which can see 'square' in a straight line
+		BitBoard attackers = MagicBitBoards::rookAttacks(square, board.occupied()) & theirs & board.m_rooks;
 
-		// --- Search Right ---
-		FORGE_FIND_STRAIGHT_ATTACK(square, rightOne, isRightFile);
-
-		// No attacks from up down left or right
-		return false;
+		return attackers.any();
 	}
 
 	bool AttackChecker::isAttackedByBishop(const Board & board, BoardSquare square)
 	{
-		BoardSquare c;
 		bool isWhite = board.isWhite(square);
 		BitBoard theirs = (isWhite ? board.blacks() : board.whites());
-		BitBoard ours = (isWhite ? board.whites() : board.blacks());
-
-		// --- Search Up Right ---
-		FORGE_FIND_DIAGONAL_ATTACK(square, upRightOne, isTopRank, isRightFile);
 
-		// --- Search Up Left ---
-		FORGE_FIND_DIAGONAL_ATTACK(square, upLeftOne, isTopRank, isLeftFile);
+		// Any of their Bishops or Queens which can see 'square' diagonally
+		BitBoard attackers = MagicBitBoards::bishopAttacks(square, board.occupied()) & theirs & board.m_bishops;
 
-		// --- Search Down Left ---
-		FORGE_FIND_DIAGONAL_ATTACK(square, downLeftOne, isBotRank, isLeftFile);
-
-		// --- Search Down Right ---
-		FORGE_FIND_DIAGONAL_ATTACK(square, downRightOne, isBotRank, isRightFile);
-
-		return false;
+		return attackers.any();
 	}
 
 	bool AttackChecker::isAttackedByKnight(const Board & board, BoardSquare square)
 	{
-		bool isWhite = board.isWhite(square);
-		BitBoard theirs = (isWhite ? board.blacks() : board.whites());
-		BitBoard ours = (isWhite ? board.whites() : board.blacks());
-
-		BoardSquare c;
+		BitBoard theirs = (board.isWhite(square) ? board.blacks() : board.whites());
 
-		if (square.isKnight0InBounds()) {
-			c = square.knight0();
-			if (board.occupied()[c] && theirs[c] && board.knights()[c]) {
-				return true;
-			}
-		}
-		if (square.isKnight1InBounds()) {
-			c = square.knight1();
-			if (board.occupied()[c] && theirs[c] && board.knights()[c]) {
-				return true;
-			}
-		}
-		if (square.isKnight2InBounds()) {
-			c = square.knight2();
-			if (board.occupied()[c] && theirs[c] && board.knights()[c]) {
-				return true;
-			}
-		}
-		if (square.isKnight3InBounds()) {
-			c = square.knight3();
-			if (board.occupied()[c] && theirs[c] && board.knights()[c]) {
-				return true;
-			}
-		}
-		if (square.isKnight4InBounds()) {
-			c = square.knight4();
-			if (board.occupied()[c] && theirs[c] && board.knights()[c]) {
-				return true;
-			}
-		}
-		if (square.isKnight5InBounds()) {
-			c = square.knight5();
-			if (board.occupied()[c] && theirs[c] && board.knights()[c]) {
-				return true;
-			}
-		}
-		if (square.isKnight6InBounds()) {
-			c = square.knight6();
-			if (board.occupied()[c] && theirs[c] && board.knights()[c]) {
-				return true;
-			}
-		}
-		if (square.isKnight7InBounds()) {
-			c = square.knight7();
-			if (board.occupied()[c] && theirs[c] && board.knights()[c]) {
-				return true;
-			}
-		}
-
-		return false;
+		// A Knight on 'square' would attack every Knight that attacks it
+		return (board.knights() & theirs & tables::knights[square.val()]).any();
 	}
 
 	bool AttackChecker::isAttackedByPawn(const Board & board, BoardSquare square)
 	{
-		bool isWhite = board.isWhite(square);
-
-		BoardSquare c;
-
-		if (isWhite) {
+		if (board.isWhite(square)) {
 			// Piece is WHITE and attacking pawns are BLACK.
-			// Pawns will move DOWN.
-			BitBoard theirs = board.blacks();
-
-			if (square.isTopRank() == false && square.isRightFile() == false) {
-				c = square.upRightOne();
-				if (board.occupied()[c] && theirs[c] && board.pawns()[c]) {
-					return true;
-				}
-			}
-			if (square.isTopRank() == false && square.isLeftFile() == false) {
-				c = square.upLeftOne();
-				if (board.occupied()[c] && theirs[c] && board.pawns()[c]) {
-					return true;
-				}
-			}
+			// They stand where a White Pawn on 'square' would capture.
+			return (pieces::WhitePawn::captureMask(square) & board.pawns() & board.blacks()).any();
 		}
 		else {
 			// Piece is BLACK and attacking pawns are WHITE.
-			// Pawns will move UP.
-			BitBoard theirs = board.whites();
-
-			if (square.isBotRank() == false && square.isRightFile() == false) {
-				c = square.downRightOne();
-				if (board.occupied()[c] && theirs[c] && board.pawns()[c]) {
-					return true;
-				}
-			}
-			if (square.isBotRank() == false && square.isLeftFile() == false) {
-				c = square.downLeftOne();
-				if (board.occupied()[c] && theirs[c] && board.pawns()[c]) {
-					return true;
-				}
-			}
+			return (pieces::BlackPawn::captureMask(square) & board.pawns() & board.whites()).any();
 		}
-
-		return false;
 	}
 
 	bool AttackChecker::isAttackedByKing(const Board & board, BoardSquare square)
 	{
 		BoardSquare theirKing = (board.isWhite(square) ? board.blackKing() : board.whiteKing());
 
-		// Calc distance between square and their king
-		int8_t vertDist = abs((int8_t)square.row() - (int8_t)theirKing.row());
-		int8_t horiDist = abs((int8_t)square.col() - (int8_t)theirKing.col());
-
-		return vertDist <= 1 && horiDist <= 1;
+		return BitBoard{ tables::kings[square.val()] }[theirKing];
 	}
 } // namespace forge
\ No newline at end of file
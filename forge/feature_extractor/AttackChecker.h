@@ -16,6 +16,11 @@ namespace forge
 		//	not to an empty square.
 		static bool isAttacked(const Board & board, BoardSquare square);
 
+		// Batch form of isAttacked(board, square) for many Boards at once.
+		// results[i] = isAttacked(boards[i], squares[i]) for i in [0, count)
+		// See Threats::genThreats() for the batch form of attack maps.
+		static void isAttacked(const Board * boards, const BoardSquare * squares, bool * results, size_t count);
+
 		static bool isKingAttacked(const Board & board, bool isWhiteKing);
 
 	private:
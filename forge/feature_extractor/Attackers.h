@@ -2,6 +2,7 @@
 
 #include "forge/core/Board.h"
 #include "forge/core/BoardSquare.h"
+#include "forge/core/MagicBitBoards.h"
 
 namespace forge
 {
@@ -18,54 +18,24 @@ namespace forge
 		static_assert(std::is_base_of<directions::Ray, RAY_DIRECTION_T>(),
 			"RAY_DIRECTION_T must be a ray direction");
 
-		// Initialize to invalid incase an attacker is not found.
-		BoardSquare attacker = BoardSquare::invalid();
-
 		// Get only the pieces which can attack in the required direction.
 		// Make sure they are of the attacking color.
 		// ex: If RAY_DIRECTION_T is Left, then get all Rooks and Queens.
 		BitBoard directionals = board.directionals<RAY_DIRECTION_T>() & aggressors;
 
-		// Get all squares where an attacker must exist on to effectively attack square.
-		BitBoard extents = BitBoard::mask<RAY_DIRECTION_T>(square);
-		
-		// Combine into one BitBoard.
-		// Now possibleAttackers is all the pieces which can attack in the specified
-		// Direction.
-		// ex: if RAY_DIRECTION_T is Left then
-		// 'possibleAttackers' would be all the Queens and Rooks of the 'aggressors' color
-		//	which exist on the same row as 'square'
-		BitBoard possibleAttackers = directionals & extents;
-
-		// Is it possible that this square is attacked from the specified direction
-		// by a piece in 'possibleAttackers'?
-		if (possibleAttackers.any()) {
-			// Yes. There might be an attacker from 'possibleAttackers' but there might 
-			// be obstacles in their way.
+		// Squares seen from 'square' in the specified direction up to and including
+		// the first obstacle. Only that obstacle can be the attacker.
+		BitBoard ray = MagicBitBoards::rayAttacks<RAY_DIRECTION_T>(square, board.occupied());
 
-			// Search in specified direction for the attacker
-			BoardSquare bs = square;
-			while (RAY_DIRECTION_T::wouldBeInBounds(bs)) {
-				bs = RAY_DIRECTION_T::move(bs);	// Increment first to skip over 'square'
+		BitBoard attacker = ray & directionals;
 
-				// What is on this square?
-				if (possibleAttackers[bs]) {
-					// --- Attacker Found ---
-					attacker = bs;
-					break;
-				}
-				else if (board.occupied()[bs]) {
-					// --- Obstacle Found (occupied by some other piece) ---
-					break;	// Attacker does not exist
-				}
-				else {
-					// --- Empty square ---
-					// Nothing to do here. Just keep looking for an attacker.
-				}
-			}
+		if (attacker.any()) {
+			// --- Attacker Found ---
+			return BoardSquare{ attacker.lsb() };
 		}
 
-		return attacker;
+		// No attacker was found.
+		return BoardSquare::invalid();
 	}
 
 	template<typename KNIGHT_DIRECTION_T>
@@ -104,20 +74,6 @@ namespace forge
 		static_assert(std::is_base_of<directions::Ray, RAY_DIRECTION_T>(),
 			"RAY_DIRECTION_T must be a ray direction");
 
-		BitBoard attacked;
-
-		while (RAY_DIRECTION_T::wouldBeInBounds(attacker)) {
-			attacker = RAY_DIRECTION_T::move(attacker);
-
-			attacked[attacker] = 1;	// attacker can attack this cell
-
-			// Does this square have anything on it?
-			if (obstacles[attacker]) {
-				// Yes. It contains some type of obstacle. Either one of our or one of their pieces.
-				break;
-			}
-		}
-
-		return attacked;
+		return MagicBitBoards::rayAttacks<RAY_DIRECTION_T>(attacker, obstacles);
 	}
 } // namespace forge
\ No newline at end of file
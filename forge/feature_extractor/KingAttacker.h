@@ -2,10 +2,12 @@
 
 #include "forge/core/BoardSquare.h"
 #include "forge/core/Board.h"
-#include "forge/core/BoardSquare.h"
+#include "forge/core/Direction.h"
 
 #include <boost/container/static_vector.hpp>
 
+#include <type_traits>
+
 namespace forge
 {
 	// A simple data type that stores information about a piece that is attacking a King.
@@ -24,6 +26,10 @@ namespace forge
 
 		// Direction of the attacker from the Kings perspective.
 		// Can be a Ray or Knight direction
-		directions::Direction dir;
+		directions::direction_t dir;
 	};
+
+	// Copied around with every KingAttackers
+	static_assert(std::is_standard_layout<KingAttacker>() && std::is_trivially_copyable<KingAttacker>(),
+		"KingAttacker must stay a plain old data type");
 } // namespace forge
\ No newline at end of file
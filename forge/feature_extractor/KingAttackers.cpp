@@ -45,7 +45,7 @@ namespace forge
 			// 2.) --- Did we find a Ray attacker? ---
 			if (attacker.isValid()) {
 				// Yes. It's coordinates are stored in 'attacker'
-				pair.push_back_rays<RAY_DIRECTION_T>(ourKing, attacker);
+				pair.push_back_rays(ourKing, attacker, RAY_DIRECTION_T::index);
 				isRayAttacking = true;
 			}
 		}
@@ -53,32 +53,29 @@ namespace forge
 
 	// Determines if 'ourKing' is being attacked by some knight.
 	// That knight may or may not be on a square. 
-	// The square will be determined by 'ourKing' and 'KNIGHT_DIRECTION_T'.
-	template<typename KNIGHT_DIRECTION_T>
+	// The square will be determined by 'ourKing' and 'dir' which must be a Knight direction.
 	inline void pushIfKnightIsAttackingKing(
+		directions::direction_t dir,
 		const BoardSquare & ourKing,
 		const BitBoard & theirKnights,
 		KingAttackers & pair,
 		bool & isKnightAttack)
 	{
-		static_assert(std::is_base_of<directions::LShape, KNIGHT_DIRECTION_T>(),
-			"This method must only be called for a LShape (Knight) direction");
-
 		// First of allToFen, determine if an attacking Knight has already been found.
 		// Remember that only 1 Knight can attack the King at a time in a Chess game.
 		if (!isKnightAttack)
 		{
 			// Is this move on the board or out-of-bounds?
-			if (KNIGHT_DIRECTION_T::wouldBeInBounds(ourKing)) {
+			if (directions::wouldBeInBounds(ourKing, dir)) {
 				// Yes. It is in-bounds.
 
 				// On which square does must the knight exist?
-				BoardSquare knight = KNIGHT_DIRECTION_T::move(ourKing);
+				BoardSquare knight = directions::move(ourKing, dir);
 
 				// Does a knight exist on this square?
 				if (theirKnights[knight]) {
 					// Yes it exists. Also, it is attacking our King.
-					pair.push_back_non_rays<KNIGHT_DIRECTION_T>(knight);
+					pair.push_back_non_rays(knight, dir);
 					isKnightAttack = true;
 				}
 			}
@@ -131,14 +128,9 @@ namespace forge
 				// Yes. A Knight is attacking our King. Lets find this Knight?
 				// TODO: Optimize: Only one Knight can attack a King at a time. Once 1 is found
 				//	we can skip the rest.
-				pushIfKnightIsAttackingKing<directions::Knight0>(ourKing, theirKnights, pair, isKnightAttack);
-				pushIfKnightIsAttackingKing<directions::Knight1>(ourKing, theirKnights, pair, isKnightAttack);
-				pushIfKnightIsAttackingKing<directions::Knight2>(ourKing, theirKnights, pair, isKnightAttack);
-				pushIfKnightIsAttackingKing<directions::Knight3>(ourKing, theirKnights, pair, isKnightAttack);
-				pushIfKnightIsAttackingKing<directions::Knight4>(ourKing, theirKnights, pair, isKnightAttack);
-				pushIfKnightIsAttackingKing<directions::Knight5>(ourKing, theirKnights, pair, isKnightAttack);
-				pushIfKnightIsAttackingKing<directions::Knight6>(ourKing, theirKnights, pair, isKnightAttack);
-				pushIfKnightIsAttackingKing<directions::Knight7>(ourKing, theirKnights, pair, isKnightAttack);
+				for (uint8_t dir = directions::KNIGHT_0; dir <= directions::KNIGHT_7; dir++) {
+					pushIfKnightIsAttackingKing(directions::direction_t(dir), ourKing, theirKnights, pair, isKnightAttack);
+				}
 			} // end Knights
 		}
 
@@ -203,12 +195,12 @@ namespace forge
 				if (ourKing.row() >= 2) {	// Black Pawns can only ever attack row 2 and down
 					if (!ourKing.isLeftFile() && theirPawns[ourKing.upLeftOne()]) {
 						// Pawn is attacking our King
-						pair.push_back_non_rays<directions::UL>(ourKing.upLeftOne());
+						pair.push_back_non_rays(ourKing.upLeftOne(), directions::UP_LEFT);
 						isPawnAttack = true;
 					}
 					if (!ourKing.isRightFile() && theirPawns[ourKing.upRightOne()]) {
 						// Pawn is attacking our King
-						pair.push_back_non_rays<directions::UR>(ourKing.upRightOne());
+						pair.push_back_non_rays(ourKing.upRightOne(), directions::UP_RIGHT);
 						isPawnAttack = true;
 					}
 				}
@@ -226,12 +218,12 @@ namespace forge
 				if (ourKing.row() <= 5) {	// White Pawns can only ever attack row 5 and up
 					if (!ourKing.isLeftFile() && theirPawns[ourKing.downLeftOne()]) {
 						// Pawn is attacking our King
-						pair.push_back_non_rays<directions::DL>(ourKing.downLeftOne());
+						pair.push_back_non_rays(ourKing.downLeftOne(), directions::DOWN_LEFT);
 						isPawnAttack = true;
 					}
 					if (!ourKing.isRightFile() && theirPawns[ourKing.downRightOne()]) {
 						// Pawn is attacking our King
-						pair.push_back_non_rays<directions::DR>(ourKing.downRightOne());
+						pair.push_back_non_rays(ourKing.downRightOne(), directions::DOWN_RIGHT);
 						isPawnAttack = true;
 					}
 				}
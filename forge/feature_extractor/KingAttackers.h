@@ -19,7 +19,7 @@ namespace forge
 		KingAttackers() = default;
 		KingAttackers(const KingAttackers &) = default;
 		KingAttackers(KingAttackers &&) noexcept = default;
-		virtual ~KingAttackers() noexcept = default;
+		~KingAttackers() noexcept = default;
 		KingAttackers & operator=(const KingAttackers &) = default;
 		KingAttackers & operator=(KingAttackers &&) noexcept = default;
 
@@ -48,11 +48,11 @@ namespace forge
 
 		bool isNotFull() const { return !isFull(); }
 
-		template<typename RAY_DIRECTION_T>
-		void push_back_rays(BoardSquare king, BoardSquare attacker);
+		// 'dir' points from the King to the attacker and must be a Ray direction.
+		void push_back_rays(BoardSquare king, BoardSquare attacker, directions::direction_t dir);
 
-		template<typename NON_RAY_DIRECTION>
-		void push_back_non_rays(BoardSquare attacker);
+		// 'dir' points from the King to the attacker. Used for Knights and Pawns.
+		void push_back_non_rays(BoardSquare attacker, directions::direction_t dir);
 
 		// ---------------------------- STATIC METHODS ------------------------
 	public:
@@ -0,0 +1,234 @@
+#include "forge/feature_extractor/KoggeStone.h"
+#include "forge/core/CpuFeatures.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define FORGE_KOGGE_STONE_AVX2
+#include <immintrin.h>
+#endif
+
+// Lets GCC and Clang emit AVX2 in single functions without compiling the whole library with -mavx2.
+#if defined(__GNUC__)
+#define FORGE_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define FORGE_TARGET_AVX2
+#endif
+
+// The lane generic templates below are always inlined into their caller, so the AVX2 kernel
+// compiles them for AVX2 as well. Their out-of-line copies are never called, so GCC's warning
+// about passing AVX registers to functions compiled without AVX does not apply.
+#if defined(_MSC_VER)
+#define FORGE_FORCE_INLINE __forceinline
+#else
+#define FORGE_FORCE_INLINE __attribute__((always_inline)) inline
+#endif
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+using namespace std;
+
+namespace forge
+{
+	namespace
+	{
+		// Squares not on the left (a) or right (h) files.
+		// Shifting across files wraps bits onto the next row. These masks drop them.
+		const uint64_t NOT_LEFT_FILE = ~0x01'01'01'01'01'01'01'01ull;
+		const uint64_t NOT_RIGHT_FILE = ~0x80'80'80'80'80'80'80'80ull;
+		const uint64_t NOT_LEFT_2_FILES = ~0x03'03'03'03'03'03'03'03ull;
+		const uint64_t NOT_RIGHT_2_FILES = ~0xC0'C0'C0'C0'C0'C0'C0'C0ull;
+
+		// --- Scalar Lanes ---
+		// 1 Board per lane
+
+		struct Scalar
+		{
+			using V = uint64_t;
+
+			static V set(uint64_t x) { return x; }
+			static V bitAnd(V a, V b) { return a & b; }
+			static V bitOr(V a, V b) { return a | b; }
+			template<int N> static V shl(V a) { return a << N; }
+			template<int N> static V shr(V a) { return a >> N; }
+		};
+
+#ifdef FORGE_KOGGE_STONE_AVX2
+		// --- AVX2 Lanes ---
+		// 4 Boards per lane
+
+		struct Avx2
+		{
+			using V = __m256i;
+
+			FORGE_TARGET_AVX2 static V set(uint64_t x) { return _mm256_set1_epi64x(static_cast<long long>(x)); }
+			FORGE_TARGET_AVX2 static V bitAnd(V a, V b) { return _mm256_and_si256(a, b); }
+			FORGE_TARGET_AVX2 static V bitOr(V a, V b) { return _mm256_or_si256(a, b); }
+			template<int N> FORGE_TARGET_AVX2 static V shl(V a) { return _mm256_slli_epi64(a, N); }
+			template<int N> FORGE_TARGET_AVX2 static V shr(V a) { return _mm256_srli_epi64(a, N); }
+		};
+#endif
+
+		// Moves every bit 1 square in some direction.
+		// Row 0 is the top of the board so Up is a right shift. Left is also a right shift.
+		//	SHIFT - How far bits move (ex: Up = 8, UL = 9). Negative values shift towards bit 0.
+		//	MASK - Squares bits are allowed to land on
+		template<typename L, int SHIFT>
+		FORGE_FORCE_INLINE typename L::V step(typename L::V bb, typename L::V mask)
+		{
+			if constexpr (SHIFT > 0)	return L::bitAnd(L::template shl<SHIFT>(bb), mask);
+			else						return L::bitAnd(L::template shr<-SHIFT>(bb), mask);
+		}
+
+		// Squares attacked in one direction by 'sliders' with occluded fill.
+		// Sliders can see through 'empty' and stop on the first occupied square (included).
+		template<typename L, int SHIFT>
+		FORGE_FORCE_INLINE typename L::V slide(typename L::V sliders, typename L::V empty, typename L::V mask)
+		{
+			// Never fill across the edge of the board
+			empty = L::bitAnd(empty, mask);
+
+			sliders = L::bitOr(sliders, L::bitAnd(empty, step<L, SHIFT>(sliders, L::set(~0ull))));
+			empty = L::bitAnd(empty, step<L, SHIFT>(empty, L::set(~0ull)));
+			sliders = L::bitOr(sliders, L::bitAnd(empty, step<L, 2 * SHIFT>(sliders, L::set(~0ull))));
+			empty = L::bitAnd(empty, step<L, 2 * SHIFT>(empty, L::set(~0ull)));
+			sliders = L::bitOr(sliders, L::bitAnd(empty, step<L, 4 * SHIFT>(sliders, L::set(~0ull))));
+
+			// Attacks are 1 square further than the fill. That square is the blocker.
+			return step<L, SHIFT>(sliders, mask);
+		}
+
+		// Every square attacked by the pieces of one lane.
+		template<typename L>
+		FORGE_FORCE_INLINE typename L::V attacksOf(
+			typename L::V laterals,
+			typename L::V diagonals,
+			typename L::V knights,
+			typename L::V whitePawns,
+			typename L::V blackPawns,
+			typename L::V kings,
+			typename L::V empty)
+		{
+			using V = typename L::V;
+
+			const V all = L::set(~0ull);
+			const V notLeft = L::set(NOT_LEFT_FILE);
+			const V notRight = L::set(NOT_RIGHT_FILE);
+			const V notLeft2 = L::set(NOT_LEFT_2_FILES);
+			const V notRight2 = L::set(NOT_RIGHT_2_FILES);
+
+			// --- Sliders ---
+			// Landing on the right file after moving left means a bit wrapped around, and vice versa.
+			V attacks = slide<L, -8>(laterals, empty, all);				// Up
+			attacks = L::bitOr(attacks, slide<L, 8>(laterals, empty, all));		// Down
+			attacks = L::bitOr(attacks, slide<L, -1>(laterals, empty, notRight));	// Left
+			attacks = L::bitOr(attacks, slide<L, 1>(laterals, empty, notLeft));	// Right
+			attacks = L::bitOr(attacks, slide<L, -9>(diagonals, empty, notRight));	// UL
+			attacks = L::bitOr(attacks, slide<L, -7>(diagonals, empty, notLeft));	// UR
+			attacks = L::bitOr(attacks, slide<L, 7>(diagonals, empty, notRight));	// DL
+			attacks = L::bitOr(attacks, slide<L, 9>(diagonals, empty, notLeft));	// DR
+
+			// --- Knights ---
+			attacks = L::bitOr(attacks, step<L, -17>(knights, notRight));
+			attacks = L::bitOr(attacks, step<L, -15>(knights, notLeft));
+			attacks = L::bitOr(attacks, step<L, -10>(knights, notRight2));
+			attacks = L::bitOr(attacks, step<L, -6>(knights, notLeft2));
+			attacks = L::bitOr(attacks, step<L, 6>(knights, notRight2));
+			attacks = L::bitOr(attacks, step<L, 10>(knights, notLeft2));
+			attacks = L::bitOr(attacks, step<L, 15>(knights, notRight));
+			attacks = L::bitOr(attacks, step<L, 17>(knights, notLeft));
+
+			// --- Pawns ---
+			// White Pawns capture Up, Black Pawns capture Down
+			attacks = L::bitOr(attacks, step<L, -9>(whitePawns, notRight));
+			attacks = L::bitOr(attacks, step<L, -7>(whitePawns, notLeft));
+			attacks = L::bitOr(attacks, step<L, 7>(blackPawns, notRight));
+			attacks = L::bitOr(attacks, step<L, 9>(blackPawns, notLeft));
+
+			// --- Kings ---
+			attacks = L::bitOr(attacks, step<L, -8>(kings, all));
+			attacks = L::bitOr(attacks, step<L, 8>(kings, all));
+			attacks = L::bitOr(attacks, step<L, -1>(kings, notRight));
+			attacks = L::bitOr(attacks, step<L, 1>(kings, notLeft));
+			attacks = L::bitOr(attacks, step<L, -9>(kings, notRight));
+			attacks = L::bitOr(attacks, step<L, -7>(kings, notLeft));
+			attacks = L::bitOr(attacks, step<L, 7>(kings, notRight));
+			attacks = L::bitOr(attacks, step<L, 9>(kings, notLeft));
+
+			return attacks;
+		}
+
+#ifdef FORGE_KOGGE_STONE_AVX2
+		// Loads 1 field of 4 consecutive Pieces into the lanes of a register.
+		FORGE_TARGET_AVX2 inline __m256i gather(const KoggeStone::Pieces * p, uint64_t KoggeStone::Pieces::* field)
+		{
+			return _mm256_set_epi64x(
+				static_cast<long long>(p[3].*field),
+				static_cast<long long>(p[2].*field),
+				static_cast<long long>(p[1].*field),
+				static_cast<long long>(p[0].*field));
+		}
+
+		// Handles every complete group of 4 Boards. Returns how many Boards were handled.
+		FORGE_TARGET_AVX2 size_t attacksAvx2(const KoggeStone::Pieces * pieces, uint64_t * attacks, size_t count)
+		{
+			using P = KoggeStone::Pieces;
+
+			size_t i = 0;
+
+			for (; i + 4 <= count; i += 4) {
+				const P * p = pieces + i;
+
+				__m256i a = attacksOf<Avx2>(
+					gather(p, &P::laterals),
+					gather(p, &P::diagonals),
+					gather(p, &P::knights),
+					gather(p, &P::whitePawns),
+					gather(p, &P::blackPawns),
+					gather(p, &P::kings),
+					gather(p, &P::empty));
+
+				_mm256_storeu_si256(reinterpret_cast<__m256i *>(attacks + i), a);
+			}
+
+			return i;
+		}
+#endif
+	} // namespace
+
+	KoggeStone::Pieces KoggeStone::piecesOf(const Board & board, BitBoard attackers, BitBoard obstacles)
+	{
+		Pieces p;
+
+		p.laterals = (board.laterals() & attackers).bits();
+		p.diagonals = (board.diagonals() & attackers).bits();
+		p.knights = (board.knights() & attackers).bits();
+		p.whitePawns = (board.pawns() & board.whites() & attackers).bits();
+		p.blackPawns = (board.pawns() & board.blacks() & attackers).bits();
+		p.kings = (board.kings() & attackers).bits();
+		p.empty = (~obstacles).bits();
+
+		return p;
+	}
+
+	uint64_t KoggeStone::attacks(const Pieces & p)
+	{
+		return attacksOf<Scalar>(p.laterals, p.diagonals, p.knights, p.whitePawns, p.blackPawns, p.kings, p.empty);
+	}
+
+	void KoggeStone::attacks(const Pieces * pieces, uint64_t * attacks, size_t count)
+	{
+		size_t i = 0;
+
+#ifdef FORGE_KOGGE_STONE_AVX2
+		if (CpuFeatures::hasAvx2()) {
+			i = attacksAvx2(pieces, attacks, count);
+		}
+#endif
+
+		// Leftovers (less than 4 Boards) and CPUs without AVX2
+		for (; i < count; i++) {
+			attacks[i] = KoggeStone::attacks(pieces[i]);
+		}
+	}
+} // namespace forge
\ No newline at end of file
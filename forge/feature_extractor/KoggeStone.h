@@ -0,0 +1,42 @@
+#pragma once
+
+#include "forge/core/Board.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace forge
+{
+	// Set-wise attack generation for many Boards at once.
+	// Sliding attacks are found with Kogge-Stone occluded fills: every slider of a Board is
+	// spread along all 8 directions at the same time with 3 shifts per direction instead
+	// of a table lookup per piece. Nothing depends on the square of a piece, so the same
+	// instructions work on 4 Boards at once in the 64-bit lanes of an AVX2 register.
+	// The AVX2 kernel is picked at runtime (See CpuFeatures). Other CPUs run the same
+	// algorithm one Board at a time.
+	// See: https://www.chessprogramming.org/Kogge-Stone_Algorithm
+	class KoggeStone
+	{
+	public:
+		// The attacking pieces of one Board and what can block them.
+		struct Pieces
+		{
+			uint64_t laterals = 0;		// Rooks and Queens
+			uint64_t diagonals = 0;		// Bishops and Queens
+			uint64_t knights = 0;
+			uint64_t whitePawns = 0;
+			uint64_t blackPawns = 0;
+			uint64_t kings = 0;
+			uint64_t empty = 0;			// Squares sliders can see through
+		};
+
+		// The pieces of 'board' on 'attackers' which can see through every square except 'obstacles'.
+		static Pieces piecesOf(const Board & board, BitBoard attackers, BitBoard obstacles);
+
+		// Every square attacked by 'pieces'.
+		static uint64_t attacks(const Pieces & pieces);
+
+		// Batch form of attacks(): attacks[i] = attacks(pieces[i]) for i in [0, count).
+		static void attacks(const Pieces * pieces, uint64_t * attacks, size_t count);
+	};
+} // namespace forge
\ No newline at end of file
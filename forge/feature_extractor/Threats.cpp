@@ -1,4 +1,8 @@
 #include "forge/feature_extractor/Threats.h"
+#include "forge/feature_extractor/KoggeStone.h"
+#include "forge/core/MagicBitBoards.h"
+
+#include <algorithm>
 
 using namespace std;
 
@@ -6,33 +10,17 @@ namespace forge
 {
 	template<> BitBoard Threats::genThreatsFor<pieces::Rook>(BoardSquare attacker, BitBoard obstacles)
 	{
-		BitBoard threats;
-
-		threats |= Attackers::genAttackLineSegment<directions::Up>(attacker, obstacles);
-		threats |= Attackers::genAttackLineSegment<directions::Down>(attacker, obstacles);
-		threats |= Attackers::genAttackLineSegment<directions::Left>(attacker, obstacles);
-		threats |= Attackers::genAttackLineSegment<directions::Right>(attacker, obstacles);
-
-		return threats;
+		return MagicBitBoards::rookAttacks(attacker, obstacles);
 	}
 
 	template<> BitBoard Threats::genThreatsFor<pieces::Bishop>(BoardSquare attacker, BitBoard obstacles)
 	{
-		BitBoard threats;
-
-		threats |= Attackers::genAttackLineSegment<directions::UL>(attacker, obstacles);
-		threats |= Attackers::genAttackLineSegment<directions::UR>(attacker, obstacles);
-		threats |= Attackers::genAttackLineSegment<directions::DR>(attacker, obstacles);
-		threats |= Attackers::genAttackLineSegment<directions::DL>(attacker, obstacles);
-
-		return threats;
+		return MagicBitBoards::bishopAttacks(attacker, obstacles);
 	}
 
 	template<> BitBoard Threats::genThreatsFor<pieces::Queen>(BoardSquare attacker, BitBoard obstacles)
 	{
-		return
-			Threats::genThreatsFor<pieces::Bishop>(attacker, obstacles) |
-			Threats::genThreatsFor<pieces::Rook>(attacker, obstacles);
+		return MagicBitBoards::queenAttacks(attacker, obstacles);
 	}
 
 	BitBoard Threats::genThreats(const Board & board, BitBoard attackers)
@@ -42,19 +30,40 @@ namespace forge
 		// obstacles is made up of allToFen pieces (including their king) excluding our king
 		BitBoard obstacles = board.occupied() & ~(board.kings() & ~attackers);
 
-		for (uint8_t row = 0; row < 8; row++) {
-			for (uint8_t col = 0; col < 8; col++) {
-				BoardSquare attacker{ row, col };
-
-				if (attackers[attacker]) {
-					threats |= genThreats(board, attacker, obstacles);
-				}
-			}
+		for (BoardSquare attacker : attackers) {
+			threats |= genThreats(board, attacker, obstacles);
 		}
 
 		return threats;
 	}
 
+	void Threats::genThreats(const Board * boards, const BitBoard * attackers, BitBoard * threats, size_t count)
+	{
+		// Boards are handed to the kernel in chunks so that nothing has to be allocated.
+		const size_t CHUNK = 64;
+		KoggeStone::Pieces pieces[CHUNK];
+		uint64_t attacks[CHUNK];
+
+		for (size_t begin = 0; begin < count; begin += CHUNK) {
+			const size_t n = min(CHUNK, count - begin);
+
+			for (size_t i = 0; i < n; i++) {
+				const Board & board = boards[begin + i];
+
+				// Same obstacles as genThreats(board, attackers)
+				BitBoard obstacles = board.occupied() & ~(board.kings() & ~attackers[begin + i]);
+
+				pieces[i] = KoggeStone::piecesOf(board, attackers[begin + i], obstacles);
+			}
+
+			KoggeStone::attacks(pieces, attacks, n);
+
+			for (size_t i = 0; i < n; i++) {
+				threats[begin + i] = BitBoard{ attacks[i] };
+			}
+		}
+	}
+
 	BitBoard Threats::genThreats(const Board & board, BoardSquare attacker, BitBoard obstacles)
 	{
 		BitBoard threats;
@@ -17,6 +17,12 @@ namespace forge
 
 		static BitBoard genThreats(const Board & board, BitBoard attackers);
 
+		// Batch form of genThreats(board, attackers) for many Boards at once.
+		// threats[i] = genThreats(boards[i], attackers[i]) for i in [0, count)
+		// Uses the vectorized kernel of KoggeStone which is much faster per Board than
+		// calling genThreats() in a loop once there are a few Boards.
+		static void genThreats(const Board * boards, const BitBoard * attackers, BitBoard * threats, size_t count);
+
 		static BitBoard genThreats(const Board & board, BoardSquare attacker, BitBoard obstacles);
 	};
 } // namespace forge
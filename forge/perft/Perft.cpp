@@ -0,0 +1,284 @@
+#include "forge/perft/Perft.h"
+
+#include "forge/perft/PerftHash.h"
+
+#include "forge/core/MoveGenerator2.h"
+#include "forge/time/stopwatch.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <thread>
+
+using namespace std;
+
+namespace forge
+{
+	namespace
+	{
+		// Walks the tree on a single Position using make/unmake.
+		// 'depth' must be at least 1.
+		size_t perftRecursive(Position & position, int depth)
+		{
+			MoveGenerator2 movegen;
+
+			// Bulk counting: No need to generate the moves of the last ply
+			if (depth == 1) {
+				return movegen.count(position);
+			}
+
+			const MoveVector & moves = movegen.generateMoves(position);
+
+			size_t nodes = 0;
+			UndoInfo undo;
+
+			for (Move move : moves) {
+				position.makeMove(move, undo);
+				nodes += perftRecursive(position, depth - 1);
+				position.unmakeMove(move, undo);
+			}
+
+			return nodes;
+		}
+
+		// Same as perftRecursive() but looks up and stores subtree counts in 'hash'.
+		size_t perftHashed(Position & position, int depth, PerftHash & hash)
+		{
+			MoveGenerator2 movegen;
+
+			// Bulk counting is cheaper than a hash lookup
+			if (depth == 1) {
+				return movegen.count(position);
+			}
+
+			const uint64_t key = PerftHash::key(position);
+			size_t nodes = 0;
+
+			if (hash.probe(key, depth, nodes)) {
+				return nodes;
+			}
+
+			const MoveVector & moves = movegen.generateMoves(position);
+
+			UndoInfo undo;
+
+			for (Move move : moves) {
+				position.makeMove(move, undo);
+				nodes += perftHashed(position, depth - 1, hash);
+				position.unmakeMove(move, undo);
+			}
+
+			hash.store(key, depth, nodes);
+
+			return nodes;
+		}
+
+		// Appends every Position 'depth' plies below 'position' to 'tasks'.
+		void collectTasks(Position & position, int depth, vector<Position> & tasks)
+		{
+			if (depth == 0) {
+				tasks.push_back(position);
+				return;
+			}
+
+			MoveGenerator2 movegen;
+			UndoInfo undo;
+
+			for (Move move : movegen.generateMoves(position)) {
+				position.makeMove(move, undo);
+				collectTasks(position, depth - 1, tasks);
+				position.unmakeMove(move, undo);
+			}
+		}
+
+		// Range of tasks first owned by one thread.
+		// Any thread may take the next task by incrementing 'next'.
+		// Aligned so that threads taking tasks from different ranges don't share a cache line.
+		struct alignas(64) TaskRange
+		{
+			atomic<size_t> next{ 0 };
+			size_t end = 0;
+		};
+	} // namespace
+
+	size_t perftParallel(const Position & position, int depth, unsigned threads, size_t hashMB)
+	{
+		// Plies to split the tree at. 2 plies give hundreds of tasks (enough to balance any number of threads)
+		const int SPLIT_DEPTH = 2;
+
+		if (depth <= SPLIT_DEPTH) {
+			return perft(position, depth);
+		}
+
+		if (threads == 0) {
+			threads = max(1u, thread::hardware_concurrency());
+		}
+
+		// --- Tasks ---
+		vector<Position> tasks;
+		Position root = position;
+		collectTasks(root, SPLIT_DEPTH, tasks);
+
+		// Deal tasks out evenly
+		unique_ptr<TaskRange[]> ranges{ new TaskRange[threads] };
+
+		for (unsigned t = 0; t < threads; t++) {
+			ranges[t].next = tasks.size() * t / threads;
+			ranges[t].end = tasks.size() * (t + 1) / threads;
+		}
+
+		unique_ptr<PerftHash> hash{ hashMB > 0 ? new PerftHash{ hashMB } : nullptr };
+		vector<size_t> nodes(threads, 0);
+
+		auto worker = [&](unsigned self) {
+			size_t count = 0;
+
+			// Own range first, then steal from the others
+			for (unsigned r = 0; r < threads; r++) {
+				TaskRange & range = ranges[(self + r) % threads];
+				size_t i;
+
+				while ((i = range.next.fetch_add(1)) < range.end) {
+					Position pos = tasks[i];
+					const int remaining = depth - SPLIT_DEPTH;
+
+					count += (hash ? perftHashed(pos, remaining, *hash) : perftRecursive(pos, remaining));
+				}
+			}
+
+			nodes[self] = count;
+		};
+
+		// --- Run ---
+		// The calling thread is one of the workers
+		vector<thread> pool;
+
+		for (unsigned t = 1; t < threads; t++) {
+			pool.emplace_back(worker, t);
+		}
+
+		worker(0);
+
+		for (thread & t : pool) {
+			t.join();
+		}
+
+		size_t total = 0;
+
+		for (size_t n : nodes) {
+			total += n;
+		}
+
+		return total;
+	}
+
+	size_t perft(const Position & position, int depth)
+	{
+		if (depth <= 0) {
+			return 1;
+		}
+
+		Position pos = position;
+
+		return perftRecursive(pos, depth);
+	}
+
+	vector<pair<Move, size_t>> divide(const Position & position, int depth)
+	{
+		vector<pair<Move, size_t>> counts;
+
+		if (depth <= 0) {
+			return counts;
+		}
+
+		Position pos = position;
+		MoveGenerator2 movegen;
+		UndoInfo undo;
+
+		for (Move move : movegen.generateMoves(pos)) {
+			pos.makeMove(move, undo);
+			counts.emplace_back(move, (depth == 1 ? 1 : perftRecursive(pos, depth - 1)));
+			pos.unmakeMove(move, undo);
+		}
+
+		return counts;
+	}
+
+	double PerftResult::nodesPerSecond() const
+	{
+		double seconds = chrono::duration<double>(elapsed).count();
+
+		return (seconds > 0.0 ? nodes / seconds : 0.0);
+	}
+
+	const vector<PerftTestCase> & perftSuite()
+	{
+		// Positions from https://www.chessprogramming.org/Perft_Results
+		static const vector<PerftTestCase> suite = {
+			// 4865609 with en passent
+			{ "Initial Position", "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w - - 0 1", 5, 4865351 },
+			// Kiwipete
+			{ "Position 2", "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w - - 0 1", 4, 3499358 },
+			// 674624 with en passent
+			{ "Position 3", "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1", 5, 671300 },
+			{ "Position 4", "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w - - 0 1", 4, 404404 },
+			{ "Position 5", "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w - - 1 8", 4, 2018609 },
+			// Matches published count
+			{ "Position 6", "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10", 4, 3894594 },
+		};
+
+		return suite;
+	}
+
+	PerftResult runPerftTest(const PerftTestCase & testCase)
+	{
+		Position position{ testCase.fen };
+		StopWatch sw;
+
+		sw.resume();
+		size_t nodes = perft(position, testCase.depth);
+		sw.pause();
+
+		return PerftResult{ testCase, nodes, sw.elapsed() };
+	}
+
+	bool runPerftSuite(ostream & os)
+	{
+		bool allPassed = true;
+		size_t totalNodes = 0;
+		chrono::nanoseconds totalElapsed{ 0 };
+
+		os << left
+			<< setw(18) << "Position"
+			<< setw(7) << "Depth"
+			<< setw(12) << "Nodes"
+			<< setw(12) << "Expected"
+			<< setw(10) << "Seconds"
+			<< setw(14) << "Nodes/s"
+			<< "Result" << '\n';
+
+		for (const PerftTestCase & testCase : perftSuite()) {
+			PerftResult result = runPerftTest(testCase);
+
+			os << left
+				<< setw(18) << testCase.name
+				<< setw(7) << testCase.depth
+				<< setw(12) << result.nodes
+				<< setw(12) << testCase.nodes
+				<< setw(10) << fixed << setprecision(3) << chrono::duration<double>(result.elapsed).count()
+				<< setw(14) << setprecision(0) << result.nodesPerSecond()
+				<< (result.passed() ? "PASS" : "FAIL") << endl;
+
+			allPassed = allPassed && result.passed();
+			totalNodes += result.nodes;
+			totalElapsed += result.elapsed;
+		}
+
+		double totalSeconds = chrono::duration<double>(totalElapsed).count();
+
+		os << "Total: " << totalNodes << " nodes in " << setprecision(3) << totalSeconds << " s ("
+			<< setprecision(0) << (totalSeconds > 0.0 ? totalNodes / totalSeconds : 0.0) << " nodes/s)\n";
+
+		return allPassed;
+	}
+} // namespace forge
\ No newline at end of file
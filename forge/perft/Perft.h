@@ -0,0 +1,66 @@
+#pragma once
+
+#include "forge/core/Move.h"
+#include "forge/core/Position.h"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace forge
+{
+	// Counts the leaf nodes of the tree of legal moves of 'position' that is 'depth' plies deep.
+	// Used to verify move generation (counts must match known values) and to measure
+	// its speed.
+	// See: https://www.chessprogramming.org/Perft
+	std::size_t perft(const Position & position, int depth);
+
+	// Same as perft() but splits the tree over a pool of threads.
+	// The positions a few plies below 'position' are dealt out evenly to the threads.
+	// A thread that runs out of positions steals the remaining ones of the other threads.
+	// Subtree counts are shared between threads in a PerftHash.
+	// threads - Number of threads. 0 uses one per hardware thread.
+	// hashMB - Size of the PerftHash in megabytes. 0 disables it.
+	std::size_t perftParallel(const Position & position, int depth, unsigned threads = 0, std::size_t hashMB = 64);
+
+	// Same as perft() but counts the leaf nodes under each legal move of 'position' separately.
+	// When a perft count is wrong, compare against another move generator to find which
+	// move the error is under. Then divide() the position after that move and repeat.
+	std::vector<std::pair<Move, std::size_t>> divide(const Position & position, int depth);
+
+	// A position with its known perft node count.
+	struct PerftTestCase
+	{
+		std::string name;
+		std::string fen;
+		int depth;
+		std::size_t nodes;	// Expected node count
+	};
+
+	struct PerftResult
+	{
+		PerftTestCase testCase;
+		std::size_t nodes;	// Actual node count
+		std::chrono::nanoseconds elapsed;
+
+		bool passed() const { return nodes == testCase.nodes; }
+
+		double nodesPerSecond() const;
+	};
+
+	// Built-in suite of standard perft positions.
+	// *** forgelib does not yet implement castling or en passent. ***
+	// *** Castling rights are removed from the FENs and node counts exclude en passent. ***
+	// *** Where neither rule is ever possible, counts match the published ones. ***
+	const std::vector<PerftTestCase> & perftSuite();
+
+	// Runs perft() on a single test case and times it.
+	PerftResult runPerftTest(const PerftTestCase & testCase);
+
+	// Runs every test case of perftSuite() and prints one line per position
+	// with its node count and nodes per second.
+	// Returns true if every node count matched.
+	bool runPerftSuite(std::ostream & os = std::cout);
+} // namespace forge
\ No newline at end of file
@@ -0,0 +1,55 @@
+#include "forge/perft/PerftHash.h"
+
+#include "forge/core/HashCombine.h"
+
+using namespace std;
+
+namespace forge
+{
+	PerftHash::PerftHash(size_t sizeMB)
+	{
+		size_t nEntries = 1;
+
+		while (nEntries * 2 * sizeof(Entry) <= sizeMB * 1024 * 1024) {
+			nEntries *= 2;
+		}
+
+		m_entries.reset(new Entry[nEntries]);
+		m_mask = nEntries - 1;
+	}
+
+	uint64_t PerftHash::key(const Position & position)
+	{
+		size_t seed = hash<Board>{}(position.board());
+
+		hash_combine(seed, position.isWhitesTurn());
+
+		return seed;
+	}
+
+	bool PerftHash::probe(uint64_t key, int depth, size_t & nodes) const
+	{
+		key = mix(key, depth);
+
+		const Entry & e = m_entries[key & m_mask];
+		const uint64_t data = e.data.load(memory_order_relaxed);
+		const uint64_t check = e.check.load(memory_order_relaxed);
+
+		if ((check ^ data) != key || (data & 0xFF) != uint64_t(depth)) return false;
+
+		nodes = static_cast<size_t>(data >> 8);
+
+		return true;
+	}
+
+	void PerftHash::store(uint64_t key, int depth, size_t nodes)
+	{
+		key = mix(key, depth);
+
+		Entry & e = m_entries[key & m_mask];
+		const uint64_t data = (uint64_t(nodes) << 8) | uint64_t(depth);
+
+		e.check.store(key ^ data, memory_order_relaxed);
+		e.data.store(data, memory_order_relaxed);
+	}
+} // namespace forge
\ No newline at end of file
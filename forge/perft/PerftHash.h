@@ -0,0 +1,44 @@
+#pragma once
+
+#include "forge/core/Position.h"
+
+#include <atomic>
+#include <memory>
+#include <stdint.h>
+
+namespace forge
+{
+	// Memoizes perft node counts of subtrees, keyed by Position and depth.
+	// Transpositions are common in perft trees so many subtrees only need to be counted once.
+	// Shared by every thread of perftParallel() without locks: Each entry stores its key
+	// XORed with its data (See: https://www.chessprogramming.org/Shared_Hash_Table#Lockless)
+	// so an entry that was torn by 2 threads writing at once simply fails to match.
+	// Entries are always replaced.
+	class PerftHash
+	{
+	public:
+		// sizeMB - Memory used by the table in megabytes. Rounded down to a power of 2 number of entries.
+		explicit PerftHash(std::size_t sizeMB);
+
+		// Key of 'position' for probe() and store(). Only the Board and the side to move matter.
+		static uint64_t key(const Position & position);
+
+		// Returns true and sets 'nodes' if the count of 'key' at 'depth' is stored.
+		bool probe(uint64_t key, int depth, std::size_t & nodes) const;
+
+		void store(uint64_t key, int depth, std::size_t nodes);
+
+	private:
+		struct Entry
+		{
+			std::atomic<uint64_t> check{ 0 };	// Key (mixed with depth) ^ data
+			std::atomic<uint64_t> data{ 0 };	// Node count (top 56 bits) and depth (low 8 bits)
+		};
+
+		// Same Position at different depths lands on different entries
+		static uint64_t mix(uint64_t key, int depth) { return key ^ (uint64_t(depth) * 0x9E3779B97F4A7C15ull); }
+
+		std::unique_ptr<Entry[]> m_entries;
+		std::size_t m_mask = 0;	// Number of entries - 1
+	};
+} // namespace forge
\ No newline at end of file
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "Timer.h"
+#include "timer.h"
 
 #include <iostream>
 #include <chrono>
@@ -1,4 +1,4 @@
-#include "StopWatch.h"
+#include "stopwatch.h"
 
 using namespace std;
 using namespace std::chrono;
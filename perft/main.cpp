@@ -0,0 +1,71 @@
+#include "forge/perft/Perft.h"
+#include "forge/time/stopwatch.h"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+using namespace std;
+
+// Usage:
+//	forgelib_perft						Runs the built-in perft suite
+//	forgelib_perft <fen> <depth>		Divides the position at 'fen' 'depth' plies deep
+//	forgelib_perft <fen> <depth> <threads>	Counts the nodes of 'fen' with perftParallel() (0 threads = all cores)
+//
+// Returns 0 on success, 1 if a node count of the suite was wrong, 2 on bad arguments.
+int main(int argc, char ** argv)
+{
+	if (argc == 1) {
+		bool allPassed = forge::runPerftSuite(cout);
+
+		return (allPassed ? 0 : 1);
+	}
+
+	if (argc != 3 && argc != 4) {
+		cerr << "Usage: " << argv[0] << " [<fen> <depth> [<threads>]]\n";
+		return 2;
+	}
+
+	forge::Position position{ string{ argv[1] } };
+	int depth = stoi(argv[2]);
+
+	forge::StopWatch sw;
+
+	if (argc == 4) {
+		unsigned threads = static_cast<unsigned>(stoul(argv[3]));
+
+		sw.resume();
+		size_t nodes = forge::perftParallel(position, depth, threads);
+		sw.pause();
+
+		double seconds = chrono::duration<double>(sw.elapsed()).count();
+
+		cout << "Nodes: " << nodes << '\n'
+			<< "Seconds: " << seconds << '\n'
+			<< "Nodes/s: " << (seconds > 0.0 ? nodes / seconds : 0.0) << '\n';
+
+		return 0;
+	}
+
+	sw.resume();
+	auto counts = forge::divide(position, depth);
+	sw.pause();
+
+	size_t nodes = 0;
+
+	for (const auto & count : counts) {
+		cout << count.first << ": " << count.second << '\n';
+
+		nodes += count.second;
+	}
+
+	double seconds = chrono::duration<double>(sw.elapsed()).count();
+
+	cout << '\n'
+		<< "Moves: " << counts.size() << '\n'
+		<< "Nodes: " << nodes << '\n'
+		<< "Seconds: " << seconds << '\n'
+		<< "Nodes/s: " << (seconds > 0.0 ? nodes / seconds : 0.0) << '\n';
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include "forge/core/Board.h"
+
+#include <iostream>
+
+using namespace std;
+using namespace forge;
+
+// Returns the Piece on 'square' according to the BitBoards alone (ignores the mailbox).
+pieces::Piece pieceFromBitBoards(const Board & board, BoardSquare square)
+{
+	pieces::Piece piece;
+
+	// Kings are looked up from their coordinates, not from the color BitBoards
+	if (board.isKing(square)) piece = pieces::whiteKing;
+	else if (board.isEmpty(square)) return pieces::empty;
+	else if (board.isQueen(square)) piece = pieces::whiteQueen;
+	else if (board.isRook(square)) piece = pieces::whiteRook;
+	else if (board.isBishop(square)) piece = pieces::whiteBishop;
+	else if (board.isKnight(square)) piece = pieces::whiteKnight;
+	else piece = pieces::whitePawn;
+
+	if (board.isBlack(square)) piece.flipColor();
+
+	return piece;
+}
+
+// Returns the number of squares where at() disagrees with the BitBoards.
+int countMailboxMismatches(const Board & board, const string & label)
+{
+	int nMismatches = 0;
+
+	for (uint8_t i = 0; i < 64; i++) {
+		BoardSquare square{ i };
+
+		if (board.at(square) != pieceFromBitBoards(board, square)) {
+			cout << label << ": at(" << square << ") = " << board.at(square)
+				<< " but BitBoards say " << pieceFromBitBoards(board, square) << '\n';
+			nMismatches++;
+		}
+	}
+
+	return nMismatches;
+}
+
+int main()
+{
+	int nFailures = 0;
+
+	// --- Emptying a King square leaves the King in place ---
+	{
+		Board board;
+		board.placeAllPieces();
+
+		board.placePiece(board.whiteKing(), pieces::empty);
+
+		nFailures += countMailboxMismatches(board, "placePiece(whiteKing, empty)");
+	}
+
+	// --- Placing a King moves it and empties its old square ---
+	{
+		Board board;
+		board.placeAllPieces();
+
+		BoardSquare oldKing = board.whiteKing();
+
+		board.placePiece(BoardSquare{ 4, 4 }, pieces::whiteKing);
+
+		nFailures += countMailboxMismatches(board, "placePiece(e4, whiteKing)");
+
+		if (board.whiteKing() != BoardSquare{ 4, 4 } || board.isOccupied(oldKing)) {
+			cout << "placePiece(e4, whiteKing): King was not moved\n";
+			nFailures++;
+		}
+	}
+
+	cout << (nFailures == 0 ? "All Board tests passed" : "Board tests failed") << '\n';
+
+	return nFailures == 0 ? 0 : 1;
+}
\ No newline at end of file